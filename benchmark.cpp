@@ -0,0 +1,419 @@
+#include "bench.pb.h"
+#ifdef PROTODB_BENCH_CODEC
+#include "bench.protodb.h"
+#endif
+#include "person.pb.h"
+#include "proto_c_mapper.hpp"
+#include "proto_db_convertor.hpp"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+using namespace proto_mapper;
+
+struct PersonS {
+  int age;
+  char name[20];
+  std::string temp;
+  std::vector<int> numbers;
+  std::vector<std::string> alas;
+};
+
+PROTO_MAPER(PROTO::Person, PersonS, DEFAULT_P2C_CONVERT,
+            DEFAULT_C2P_CONVERT,
+            PROTO_MEMBER(PersonS, char *, name),
+            PROTO_MEMBER(PersonS, std::string, temp),
+            PROTO_MEMBER(PersonS, std::vector<int>, numbers),
+            PROTO_MEMBER(PersonS, std::vector<std::string>, alas),
+            PROTO_MEMBER(PersonS, int, age));
+
+struct Options {
+  std::string db = ":memory:";
+  std::string format = "csv";
+  std::vector<size_t> rows = {1000, 10000, 100000};
+  std::vector<size_t> string_sizes = {16, 256};
+};
+
+struct Result {
+  std::string scenario;
+  std::string message;
+  int fields;
+  size_t rows;
+  size_t string_size;
+  double seconds;
+};
+
+static std::vector<size_t> parse_list(const std::string &text) {
+  std::vector<size_t> values;
+  std::stringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    values.push_back(std::stoul(item));
+  }
+  return values;
+}
+
+static double time_it(const std::function<void()> &fn) {
+  auto begin = std::chrono::steady_clock::now();
+  fn();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       begin)
+      .count();
+}
+
+// Fills every scalar field of msg from i, strings get string_size bytes.
+static void fill(google::protobuf::Message *msg, size_t i,
+                 size_t string_size) {
+  const auto *descriptor = msg->GetDescriptor();
+  const auto *reflection = msg->GetReflection();
+  for (int f = 0; f < descriptor->field_count(); ++f) {
+    const auto *field = descriptor->field(f);
+    if (field->is_repeated()) {
+      continue;
+    }
+    switch (field->cpp_type()) {
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+      reflection->SetInt32(msg, field, (int32_t)(i * 7));
+      break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+      reflection->SetInt64(msg, field, (int64_t)i);
+      break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+      reflection->SetUInt32(msg, field, (uint32_t)i);
+      break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+      reflection->SetUInt64(msg, field, i);
+      break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+      reflection->SetFloat(msg, field, (float)i / 3);
+      break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+      reflection->SetDouble(msg, field, (double)i / 3);
+      break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+      reflection->SetBool(msg, field, i % 2 == 0);
+      break;
+    case google::protobuf::FieldDescriptor::CPPTYPE_STRING: {
+      std::string value = std::to_string(i);
+      value.resize(std::max(string_size, value.size()), 'x');
+      reflection->SetString(msg, field, value);
+      break;
+    }
+    default:
+      break;
+    }
+  }
+}
+
+template <typename T>
+static void run_convertor(const Options &options, size_t rows,
+                          size_t string_size, std::vector<Result> &results) {
+  const std::string message = T::descriptor()->name();
+  const int fields = T::descriptor()->field_count();
+  std::vector<T> data(rows);
+  for (size_t i = 0; i < rows; ++i) {
+    fill(&data[i], i, string_size);
+  }
+  auto record = [&](const std::string &scenario, double seconds) {
+    results.push_back({scenario, message, fields, rows, string_size, seconds});
+  };
+
+  auto db = std::make_shared<SafeSQLite>(options.db);
+  db->execute("DROP TABLE IF EXISTS " + message);
+  ConvertorOptions convertor_options;
+  convertor_options.primary_key = "id";
+  convertor_options.need_create_table = true;
+#ifdef PROTODB_BENCH_CODEC
+  ProtoDBConvertor<T> conv(db, convertor_options, generated_codec);
+#else
+  ProtoDBConvertor<T> conv(db, convertor_options);
+#endif
+
+  record("write_single", time_it([&] {
+           for (const auto &row : data) {
+             conv.write(row);
+           }
+         }));
+  db->execute("DELETE FROM " + message);
+  record("write_batch", time_it([&] { conv.write(data); }));
+  record("read_full", time_it([&] {
+           if (conv.read().size() != rows) {
+             throw std::runtime_error("read_full lost rows");
+           }
+         }));
+  record("read_filtered", time_it([&] {
+           auto half = conv.read("select * from " + message + " where id < ?",
+                                 (int64_t)rows / 2);
+           if (half.size() != rows / 2) {
+             throw std::runtime_error("read_filtered lost rows");
+           }
+         }));
+  record("delete", time_it([&] {
+           SafeSQLite::Transaction transaction(*db);
+           for (const auto &row : data) {
+             conv.delete_obj(row);
+           }
+           transaction.commit();
+         }));
+}
+
+// Direct accessor binds and decodes of the bench messages, columns in field
+// order as the convertor creates them.
+template <typename T> static void raw_bind4(sqlite3_stmt *stmt, const T &row) {
+  sqlite3_bind_int64(stmt, 1, row.id());
+  sqlite3_bind_int(stmt, 2, row.count());
+  sqlite3_bind_double(stmt, 3, row.score());
+  sqlite3_bind_text(stmt, 4, row.label().data(), (int)row.label().size(),
+                    SQLITE_STATIC);
+}
+
+template <typename T> static void raw_bind8(sqlite3_stmt *stmt, const T &row) {
+  raw_bind4(stmt, row);
+  sqlite3_bind_int64(stmt, 5, row.total());
+  sqlite3_bind_int(stmt, 6, row.flag());
+  sqlite3_bind_text(stmt, 7, row.note().data(), (int)row.note().size(),
+                    SQLITE_STATIC);
+  sqlite3_bind_double(stmt, 8, row.ratio());
+}
+
+static void raw_bind(sqlite3_stmt *stmt, const PROTO::BenchRow4 &row) {
+  raw_bind4(stmt, row);
+}
+
+static void raw_bind(sqlite3_stmt *stmt, const PROTO::BenchRow8 &row) {
+  raw_bind8(stmt, row);
+}
+
+static void raw_bind(sqlite3_stmt *stmt, const PROTO::BenchRow16 &row) {
+  raw_bind8(stmt, row);
+  sqlite3_bind_int64(stmt, 9, row.level());
+  sqlite3_bind_int64(stmt, 10, row.delta());
+  sqlite3_bind_text(stmt, 11, row.owner().data(), (int)row.owner().size(),
+                    SQLITE_STATIC);
+  sqlite3_bind_double(stmt, 12, row.weight());
+  sqlite3_bind_int(stmt, 13, row.rank());
+  sqlite3_bind_int64(stmt, 14, (sqlite3_int64)row.stamp());
+  sqlite3_bind_text(stmt, 15, row.region().data(), (int)row.region().size(),
+                    SQLITE_STATIC);
+  sqlite3_bind_int(stmt, 16, row.active());
+}
+
+static std::string raw_text(sqlite3_stmt *stmt, int i) {
+  return std::string((const char *)sqlite3_column_text(stmt, i),
+                     sqlite3_column_bytes(stmt, i));
+}
+
+template <typename T> static void raw_decode4(sqlite3_stmt *stmt, T *row) {
+  row->set_id(sqlite3_column_int64(stmt, 0));
+  row->set_count(sqlite3_column_int(stmt, 1));
+  row->set_score(sqlite3_column_double(stmt, 2));
+  row->set_label(raw_text(stmt, 3));
+}
+
+template <typename T> static void raw_decode8(sqlite3_stmt *stmt, T *row) {
+  raw_decode4(stmt, row);
+  row->set_total(sqlite3_column_int64(stmt, 4));
+  row->set_flag(sqlite3_column_int(stmt, 5) != 0);
+  row->set_note(raw_text(stmt, 6));
+  row->set_ratio((float)sqlite3_column_double(stmt, 7));
+}
+
+static void raw_decode(sqlite3_stmt *stmt, PROTO::BenchRow4 *row) {
+  raw_decode4(stmt, row);
+}
+
+static void raw_decode(sqlite3_stmt *stmt, PROTO::BenchRow8 *row) {
+  raw_decode8(stmt, row);
+}
+
+static void raw_decode(sqlite3_stmt *stmt, PROTO::BenchRow16 *row) {
+  raw_decode8(stmt, row);
+  row->set_level((uint32_t)sqlite3_column_int64(stmt, 8));
+  row->set_delta(sqlite3_column_int64(stmt, 9));
+  row->set_owner(raw_text(stmt, 10));
+  row->set_weight(sqlite3_column_double(stmt, 11));
+  row->set_rank(sqlite3_column_int(stmt, 12));
+  row->set_stamp((uint64_t)sqlite3_column_int64(stmt, 13));
+  row->set_region(raw_text(stmt, 14));
+  row->set_active(sqlite3_column_int(stmt, 15) != 0);
+}
+
+// The same rows and table as run_convertor<T> through sqlite3 directly,
+// with no reflection.
+template <typename T>
+static void run_raw_sqlite(const Options &options, size_t rows,
+                           size_t string_size, std::vector<Result> &results) {
+  const std::string message = T::descriptor()->name();
+  const int fields = T::descriptor()->field_count();
+  std::vector<T> data(rows);
+  for (size_t i = 0; i < rows; ++i) {
+    fill(&data[i], i, string_size);
+  }
+  auto record = [&](const std::string &scenario, double seconds) {
+    results.push_back({scenario, message, fields, rows, string_size, seconds});
+  };
+
+  std::string create_sql =
+      "DROP TABLE IF EXISTS " + message + ";CREATE TABLE " + message + " (";
+  std::string values;
+  for (int f = 0; f < fields; ++f) {
+    const auto *field = T::descriptor()->field(f);
+    create_sql += field->name() + " " + sql_type_of(*field);
+    if (field->name() == "id") {
+      create_sql += " PRIMARY KEY NOT NULL ON CONFLICT REPLACE";
+    }
+    create_sql += ",";
+    values += "?,";
+  }
+  create_sql.back() = ')';
+  values.pop_back();
+
+  sqlite3 *db;
+  if (sqlite3_open(options.db.c_str(), &db) != SQLITE_OK) {
+    throw std::runtime_error("Failed to open database");
+  }
+  sqlite3_exec(db, create_sql.c_str(), nullptr, nullptr, nullptr);
+  sqlite3_stmt *insert;
+  sqlite3_prepare_v2(db,
+                     ("REPLACE INTO " + message + " VALUES (" + values + ")")
+                         .c_str(),
+                     -1, &insert, nullptr);
+  record("raw_write_batch", time_it([&] {
+           sqlite3_exec(db, "BEGIN", nullptr, nullptr, nullptr);
+           for (const auto &row : data) {
+             raw_bind(insert, row);
+             sqlite3_step(insert);
+             sqlite3_reset(insert);
+           }
+           sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+         }));
+  sqlite3_finalize(insert);
+
+  sqlite3_stmt *select;
+  sqlite3_prepare_v2(db, ("SELECT * FROM " + message).c_str(), -1, &select,
+                     nullptr);
+  record("raw_read_full", time_it([&] {
+           std::vector<T> result;
+           while (sqlite3_step(select) == SQLITE_ROW) {
+             T row;
+             raw_decode(select, &row);
+             result.push_back(std::move(row));
+           }
+           if (result.size() != rows) {
+             throw std::runtime_error("raw_read_full lost rows");
+           }
+         }));
+  sqlite3_finalize(select);
+  sqlite3_close(db);
+}
+
+static void run_mapper(size_t rows, size_t string_size,
+                       std::vector<Result> &results) {
+  PROTO::Person person;
+  fill(&person, 1, string_size);
+  person.set_name("mapper");
+  for (int i = 0; i < 8; ++i) {
+    person.add_numbers(i);
+    person.add_alas(std::string(string_size, 'a'));
+  }
+  PersonS data = PersonSPBMapper::toC(person);
+  auto record = [&](const std::string &scenario, double seconds) {
+    results.push_back(
+        {scenario, "PersonS", 5, rows, string_size, seconds});
+  };
+
+  size_t sink = 0;
+  record("mapper_toC", time_it([&] {
+           for (size_t i = 0; i < rows; ++i) {
+             sink += PersonSPBMapper::toC(person).numbers.size();
+           }
+         }));
+  record("mapper_toP", time_it([&] {
+           for (size_t i = 0; i < rows; ++i) {
+             sink += PersonSPBMapper::toP(data).numbers_size();
+           }
+         }));
+  if (sink == 0) {
+    std::cerr << "mapper produced nothing" << std::endl;
+  }
+}
+
+static void print(const Options &options, const std::vector<Result> &results) {
+  bool json = options.format == "json";
+  if (json) {
+    std::cout << "[" << std::endl;
+  } else {
+    std::cout << "scenario,message,fields,rows,string_size,seconds,"
+                 "rows_per_sec,ns_per_row"
+              << std::endl;
+  }
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto &r = results[i];
+    double rows_per_sec = r.seconds > 0 ? r.rows / r.seconds : 0;
+    double ns_per_row = r.rows > 0 ? r.seconds * 1e9 / r.rows : 0;
+    char line[512];
+    if (json) {
+      snprintf(line, sizeof(line),
+               "  {\"scenario\": \"%s\", \"message\": \"%s\", \"fields\": %d, "
+               "\"rows\": %zu, \"string_size\": %zu, \"seconds\": %.6f, "
+               "\"rows_per_sec\": %.1f, \"ns_per_row\": %.1f}%s",
+               r.scenario.c_str(), r.message.c_str(), r.fields, r.rows,
+               r.string_size, r.seconds, rows_per_sec, ns_per_row,
+               i + 1 < results.size() ? "," : "");
+    } else {
+      snprintf(line, sizeof(line), "%s,%s,%d,%zu,%zu,%.6f,%.1f,%.1f",
+               r.scenario.c_str(), r.message.c_str(), r.fields, r.rows,
+               r.string_size, r.seconds, rows_per_sec, ns_per_row);
+    }
+    std::cout << line << std::endl;
+  }
+  if (json) {
+    std::cout << "]" << std::endl;
+  }
+}
+
+int main(int argc, char **argv) {
+  Options options;
+  auto usage = [&] {
+    std::cerr << "usage: " << argv[0]
+              << " [--db file] [--format csv|json] [--rows 1000,10000]"
+                 " [--string-sizes 16,256]"
+              << std::endl;
+    return 1;
+  };
+  for (int i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 == argc) {
+      return usage();
+    }
+    std::string value = argv[i + 1];
+    if (flag == "--db") {
+      options.db = value;
+    } else if (flag == "--format") {
+      options.format = value;
+    } else if (flag == "--rows") {
+      options.rows = parse_list(value);
+    } else if (flag == "--string-sizes") {
+      options.string_sizes = parse_list(value);
+    } else {
+      return usage();
+    }
+  }
+
+  std::vector<Result> results;
+  for (size_t rows : options.rows) {
+    for (size_t string_size : options.string_sizes) {
+      run_convertor<PROTO::BenchRow4>(options, rows, string_size, results);
+      run_raw_sqlite<PROTO::BenchRow4>(options, rows, string_size, results);
+      run_convertor<PROTO::BenchRow8>(options, rows, string_size, results);
+      run_raw_sqlite<PROTO::BenchRow8>(options, rows, string_size, results);
+      run_convertor<PROTO::BenchRow16>(options, rows, string_size, results);
+      run_raw_sqlite<PROTO::BenchRow16>(options, rows, string_size, results);
+      run_mapper(rows, string_size, results);
+    }
+  }
+  print(options, results);
+  return 0;
+}
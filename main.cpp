@@ -48,16 +48,16 @@ int main() {
   ps.add_people()->CopyFrom(msg);
   ps.add_people()->CopyFrom(msg);
 
-  ProtoDBConvertor<PROTO::Persons> personsConv(sqLite, "group_id", {"people"},
-                                               true);
+  ProtoDBConvertor<PROTO::Persons> personsConv(
+      sqLite, "group_id", {"people.numbers", "people.alas"}, true);
   personsConv.write(ps);
   auto pses = personsConv.read();
   for (auto &r : pses) {
     std::cout << r.ShortDebugString() << std::endl;
   }
 
-  auto pses2 = personsConv.read("select * from Persons where count = 5;");
-  for (auto &r : pses) {
+  auto pses2 = personsConv.read("select * from Persons where count = ?;", 5);
+  for (auto &r : pses2) {
     std::cout << r.ShortDebugString() << std::endl;
   }
 
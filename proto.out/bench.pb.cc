@@ -0,0 +1,1796 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: bench.proto
+
+#include "bench.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace PROTO {
+PROTOBUF_CONSTEXPR BenchRow4::BenchRow4(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/int64_t{0}
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.count_)*/0} {}
+struct BenchRow4DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BenchRow4DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BenchRow4DefaultTypeInternal() {}
+  union {
+    BenchRow4 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BenchRow4DefaultTypeInternal _BenchRow4_default_instance_;
+PROTOBUF_CONSTEXPR BenchRow8::BenchRow8(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.note_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/int64_t{0}
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.count_)*/0
+  , /*decltype(_impl_.flag_)*/false
+  , /*decltype(_impl_.total_)*/int64_t{0}
+  , /*decltype(_impl_.ratio_)*/0} {}
+struct BenchRow8DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BenchRow8DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BenchRow8DefaultTypeInternal() {}
+  union {
+    BenchRow8 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BenchRow8DefaultTypeInternal _BenchRow8_default_instance_;
+PROTOBUF_CONSTEXPR BenchRow16::BenchRow16(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.label_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.note_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.owner_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.region_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/int64_t{0}
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.total_)*/int64_t{0}
+  , /*decltype(_impl_.count_)*/0
+  , /*decltype(_impl_.ratio_)*/0
+  , /*decltype(_impl_.delta_)*/int64_t{0}
+  , /*decltype(_impl_.level_)*/0u
+  , /*decltype(_impl_.flag_)*/false
+  , /*decltype(_impl_.active_)*/false
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_.stamp_)*/uint64_t{0u}
+  , /*decltype(_impl_.rank_)*/0} {}
+struct BenchRow16DefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BenchRow16DefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BenchRow16DefaultTypeInternal() {}
+  union {
+    BenchRow16 _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BenchRow16DefaultTypeInternal _BenchRow16_default_instance_;
+}  // namespace PROTO
+static ::_pb::Metadata file_level_metadata_bench_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_bench_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_bench_2eproto = nullptr;
+
+const uint32_t TableStruct_bench_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow4, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow4, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow4, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow4, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow4, _impl_.score_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow4, _impl_.label_),
+  1,
+  3,
+  2,
+  0,
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.score_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.label_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.flag_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.note_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow8, _impl_.ratio_),
+  2,
+  4,
+  3,
+  0,
+  6,
+  5,
+  1,
+  7,
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.score_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.label_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.total_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.flag_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.note_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.ratio_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.level_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.delta_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.owner_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.rank_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.stamp_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.region_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::BenchRow16, _impl_.active_),
+  4,
+  7,
+  5,
+  0,
+  6,
+  11,
+  1,
+  8,
+  10,
+  9,
+  2,
+  13,
+  15,
+  14,
+  3,
+  12,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::PROTO::BenchRow4)},
+  { 14, 28, -1, sizeof(::PROTO::BenchRow8)},
+  { 36, 58, -1, sizeof(::PROTO::BenchRow16)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::PROTO::_BenchRow4_default_instance_._instance,
+  &::PROTO::_BenchRow8_default_instance_._instance,
+  &::PROTO::_BenchRow16_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_bench_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013bench.proto\022\005PROTO\"D\n\tBenchRow4\022\n\n\002id\030"
+  "\001 \002(\003\022\r\n\005count\030\002 \001(\005\022\r\n\005score\030\003 \001(\001\022\r\n\005l"
+  "abel\030\004 \001(\t\"~\n\tBenchRow8\022\n\n\002id\030\001 \002(\003\022\r\n\005c"
+  "ount\030\002 \001(\005\022\r\n\005score\030\003 \001(\001\022\r\n\005label\030\004 \001(\t"
+  "\022\r\n\005total\030\005 \001(\003\022\014\n\004flag\030\006 \001(\010\022\014\n\004note\030\007 "
+  "\001(\t\022\r\n\005ratio\030\010 \001(\002\"\371\001\n\nBenchRow16\022\n\n\002id\030"
+  "\001 \002(\003\022\r\n\005count\030\002 \001(\005\022\r\n\005score\030\003 \001(\001\022\r\n\005l"
+  "abel\030\004 \001(\t\022\r\n\005total\030\005 \001(\003\022\014\n\004flag\030\006 \001(\010\022"
+  "\014\n\004note\030\007 \001(\t\022\r\n\005ratio\030\010 \001(\002\022\r\n\005level\030\t "
+  "\001(\r\022\r\n\005delta\030\n \001(\022\022\r\n\005owner\030\013 \001(\t\022\016\n\006wei"
+  "ght\030\014 \001(\001\022\014\n\004rank\030\r \001(\005\022\r\n\005stamp\030\016 \001(\006\022\016"
+  "\n\006region\030\017 \001(\t\022\016\n\006active\030\020 \001(\010"
+  ;
+static ::_pbi::once_flag descriptor_table_bench_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_bench_2eproto = {
+    false, false, 470, descriptor_table_protodef_bench_2eproto,
+    "bench.proto",
+    &descriptor_table_bench_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_bench_2eproto::offsets,
+    file_level_metadata_bench_2eproto, file_level_enum_descriptors_bench_2eproto,
+    file_level_service_descriptors_bench_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_bench_2eproto_getter() {
+  return &descriptor_table_bench_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_bench_2eproto(&descriptor_table_bench_2eproto);
+namespace PROTO {
+
+// ===================================================================
+
+class BenchRow4::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BenchRow4>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+BenchRow4::BenchRow4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PROTO.BenchRow4)
+}
+BenchRow4::BenchRow4(const BenchRow4& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BenchRow4* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.score_){}
+    , decltype(_impl_.count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_label()) {
+    _this->_impl_.label_.Set(from._internal_label(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:PROTO.BenchRow4)
+}
+
+inline void BenchRow4::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.id_){int64_t{0}}
+    , decltype(_impl_.score_){0}
+    , decltype(_impl_.count_){0}
+  };
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BenchRow4::~BenchRow4() {
+  // @@protoc_insertion_point(destructor:PROTO.BenchRow4)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BenchRow4::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.label_.Destroy();
+}
+
+void BenchRow4::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BenchRow4::Clear() {
+// @@protoc_insertion_point(message_clear_start:PROTO.BenchRow4)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.label_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.count_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BenchRow4::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double score = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_score(&has_bits);
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string label = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_label();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.BenchRow4.label");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BenchRow4::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PROTO.BenchRow4)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // optional int32 count = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_count(), target);
+  }
+
+  // optional double score = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_score(), target);
+  }
+
+  // optional string label = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_label().data(), static_cast<int>(this->_internal_label().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.BenchRow4.label");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_label(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PROTO.BenchRow4)
+  return target;
+}
+
+size_t BenchRow4::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PROTO.BenchRow4)
+  size_t total_size = 0;
+
+  // required int64 id = 1;
+  if (_internal_has_id()) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_id());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string label = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_label());
+  }
+
+  if (cached_has_bits & 0x0000000cu) {
+    // optional double score = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 count = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_count());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BenchRow4::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BenchRow4::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BenchRow4::GetClassData() const { return &_class_data_; }
+
+
+void BenchRow4::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BenchRow4*>(&to_msg);
+  auto& from = static_cast<const BenchRow4&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PROTO.BenchRow4)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_label(from._internal_label());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.score_ = from._impl_.score_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BenchRow4::CopyFrom(const BenchRow4& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PROTO.BenchRow4)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BenchRow4::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BenchRow4::InternalSwap(BenchRow4* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_, lhs_arena,
+      &other->_impl_.label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BenchRow4, _impl_.count_)
+      + sizeof(BenchRow4::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(BenchRow4, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BenchRow4::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_bench_2eproto_getter, &descriptor_table_bench_2eproto_once,
+      file_level_metadata_bench_2eproto[0]);
+}
+
+// ===================================================================
+
+class BenchRow8::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BenchRow8>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_total(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_flag(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_note(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ratio(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000004) ^ 0x00000004) != 0;
+  }
+};
+
+BenchRow8::BenchRow8(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PROTO.BenchRow8)
+}
+BenchRow8::BenchRow8(const BenchRow8& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BenchRow8* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.note_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.score_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.flag_){}
+    , decltype(_impl_.total_){}
+    , decltype(_impl_.ratio_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_label()) {
+    _this->_impl_.label_.Set(from._internal_label(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.note_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.note_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_note()) {
+    _this->_impl_.note_.Set(from._internal_note(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ratio_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.ratio_));
+  // @@protoc_insertion_point(copy_constructor:PROTO.BenchRow8)
+}
+
+inline void BenchRow8::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.note_){}
+    , decltype(_impl_.id_){int64_t{0}}
+    , decltype(_impl_.score_){0}
+    , decltype(_impl_.count_){0}
+    , decltype(_impl_.flag_){false}
+    , decltype(_impl_.total_){int64_t{0}}
+    , decltype(_impl_.ratio_){0}
+  };
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.note_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.note_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BenchRow8::~BenchRow8() {
+  // @@protoc_insertion_point(destructor:PROTO.BenchRow8)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BenchRow8::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.label_.Destroy();
+  _impl_.note_.Destroy();
+}
+
+void BenchRow8::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BenchRow8::Clear() {
+// @@protoc_insertion_point(message_clear_start:PROTO.BenchRow8)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.label_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.note_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.ratio_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.ratio_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BenchRow8::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double score = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_score(&has_bits);
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string label = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_label();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.BenchRow8.label");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 total = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_total(&has_bits);
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool flag = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_flag(&has_bits);
+          _impl_.flag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string note = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_note();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.BenchRow8.note");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float ratio = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_ratio(&has_bits);
+          _impl_.ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BenchRow8::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PROTO.BenchRow8)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 id = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // optional int32 count = 2;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_count(), target);
+  }
+
+  // optional double score = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_score(), target);
+  }
+
+  // optional string label = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_label().data(), static_cast<int>(this->_internal_label().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.BenchRow8.label");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_label(), target);
+  }
+
+  // optional int64 total = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_total(), target);
+  }
+
+  // optional bool flag = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_flag(), target);
+  }
+
+  // optional string note = 7;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_note().data(), static_cast<int>(this->_internal_note().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.BenchRow8.note");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_note(), target);
+  }
+
+  // optional float ratio = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_ratio(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PROTO.BenchRow8)
+  return target;
+}
+
+size_t BenchRow8::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PROTO.BenchRow8)
+  size_t total_size = 0;
+
+  // required int64 id = 1;
+  if (_internal_has_id()) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_id());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string label = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_label());
+    }
+
+    // optional string note = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_note());
+    }
+
+  }
+  if (cached_has_bits & 0x000000f8u) {
+    // optional double score = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 count = 2;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_count());
+    }
+
+    // optional bool flag = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+    // optional int64 total = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_total());
+    }
+
+    // optional float ratio = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 + 4;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BenchRow8::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BenchRow8::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BenchRow8::GetClassData() const { return &_class_data_; }
+
+
+void BenchRow8::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BenchRow8*>(&to_msg);
+  auto& from = static_cast<const BenchRow8&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PROTO.BenchRow8)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_label(from._internal_label());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_note(from._internal_note());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.score_ = from._impl_.score_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.flag_ = from._impl_.flag_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.total_ = from._impl_.total_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.ratio_ = from._impl_.ratio_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BenchRow8::CopyFrom(const BenchRow8& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PROTO.BenchRow8)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BenchRow8::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BenchRow8::InternalSwap(BenchRow8* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_, lhs_arena,
+      &other->_impl_.label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.note_, lhs_arena,
+      &other->_impl_.note_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BenchRow8, _impl_.ratio_)
+      + sizeof(BenchRow8::_impl_.ratio_)
+      - PROTOBUF_FIELD_OFFSET(BenchRow8, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BenchRow8::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_bench_2eproto_getter, &descriptor_table_bench_2eproto_once,
+      file_level_metadata_bench_2eproto[1]);
+}
+
+// ===================================================================
+
+class BenchRow16::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BenchRow16>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_label(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_total(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_flag(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_note(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_ratio(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_level(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_delta(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_owner(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_rank(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static void set_has_stamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_region(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_active(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000010) ^ 0x00000010) != 0;
+  }
+};
+
+BenchRow16::BenchRow16(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PROTO.BenchRow16)
+}
+BenchRow16::BenchRow16(const BenchRow16& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BenchRow16* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.note_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.region_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.score_){}
+    , decltype(_impl_.total_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.ratio_){}
+    , decltype(_impl_.delta_){}
+    , decltype(_impl_.level_){}
+    , decltype(_impl_.flag_){}
+    , decltype(_impl_.active_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.stamp_){}
+    , decltype(_impl_.rank_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_label()) {
+    _this->_impl_.label_.Set(from._internal_label(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.note_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.note_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_note()) {
+    _this->_impl_.note_.Set(from._internal_note(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_owner()) {
+    _this->_impl_.owner_.Set(from._internal_owner(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.region_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.region_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_region()) {
+    _this->_impl_.region_.Set(from._internal_region(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rank_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.rank_));
+  // @@protoc_insertion_point(copy_constructor:PROTO.BenchRow16)
+}
+
+inline void BenchRow16::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.label_){}
+    , decltype(_impl_.note_){}
+    , decltype(_impl_.owner_){}
+    , decltype(_impl_.region_){}
+    , decltype(_impl_.id_){int64_t{0}}
+    , decltype(_impl_.score_){0}
+    , decltype(_impl_.total_){int64_t{0}}
+    , decltype(_impl_.count_){0}
+    , decltype(_impl_.ratio_){0}
+    , decltype(_impl_.delta_){int64_t{0}}
+    , decltype(_impl_.level_){0u}
+    , decltype(_impl_.flag_){false}
+    , decltype(_impl_.active_){false}
+    , decltype(_impl_.weight_){0}
+    , decltype(_impl_.stamp_){uint64_t{0u}}
+    , decltype(_impl_.rank_){0}
+  };
+  _impl_.label_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.label_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.note_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.note_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.owner_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.region_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.region_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BenchRow16::~BenchRow16() {
+  // @@protoc_insertion_point(destructor:PROTO.BenchRow16)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BenchRow16::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.label_.Destroy();
+  _impl_.note_.Destroy();
+  _impl_.owner_.Destroy();
+  _impl_.region_.Destroy();
+}
+
+void BenchRow16::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BenchRow16::Clear() {
+// @@protoc_insertion_point(message_clear_start:PROTO.BenchRow16)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.label_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.note_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.owner_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.region_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.count_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.count_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.ratio_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.rank_) -
+        reinterpret_cast<char*>(&_impl_.ratio_)) + sizeof(_impl_.rank_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BenchRow16::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double score = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_score(&has_bits);
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string label = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_label();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.BenchRow16.label");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 total = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_total(&has_bits);
+          _impl_.total_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool flag = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_flag(&has_bits);
+          _impl_.flag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string note = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_note();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.BenchRow16.note");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional float ratio = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_ratio(&has_bits);
+          _impl_.ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 level = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_level(&has_bits);
+          _impl_.level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional sint64 delta = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_delta(&has_bits);
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string owner = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_owner();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.BenchRow16.owner");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double weight = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_weight(&has_bits);
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 rank = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_rank(&has_bits);
+          _impl_.rank_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed64 stamp = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 113)) {
+          _Internal::set_has_stamp(&has_bits);
+          _impl_.stamp_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string region = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          auto str = _internal_mutable_region();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.BenchRow16.region");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool active = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _Internal::set_has_active(&has_bits);
+          _impl_.active_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BenchRow16::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PROTO.BenchRow16)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int64 id = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // optional int32 count = 2;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_count(), target);
+  }
+
+  // optional double score = 3;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_score(), target);
+  }
+
+  // optional string label = 4;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_label().data(), static_cast<int>(this->_internal_label().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.BenchRow16.label");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_label(), target);
+  }
+
+  // optional int64 total = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_total(), target);
+  }
+
+  // optional bool flag = 6;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_flag(), target);
+  }
+
+  // optional string note = 7;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_note().data(), static_cast<int>(this->_internal_note().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.BenchRow16.note");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_note(), target);
+  }
+
+  // optional float ratio = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_ratio(), target);
+  }
+
+  // optional uint32 level = 9;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_level(), target);
+  }
+
+  // optional sint64 delta = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(10, this->_internal_delta(), target);
+  }
+
+  // optional string owner = 11;
+  if (cached_has_bits & 0x00000004u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_owner().data(), static_cast<int>(this->_internal_owner().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.BenchRow16.owner");
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_owner(), target);
+  }
+
+  // optional double weight = 12;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_weight(), target);
+  }
+
+  // optional int32 rank = 13;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_rank(), target);
+  }
+
+  // optional fixed64 stamp = 14;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(14, this->_internal_stamp(), target);
+  }
+
+  // optional string region = 15;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_region().data(), static_cast<int>(this->_internal_region().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.BenchRow16.region");
+    target = stream->WriteStringMaybeAliased(
+        15, this->_internal_region(), target);
+  }
+
+  // optional bool active = 16;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(16, this->_internal_active(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PROTO.BenchRow16)
+  return target;
+}
+
+size_t BenchRow16::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PROTO.BenchRow16)
+  size_t total_size = 0;
+
+  // required int64 id = 1;
+  if (_internal_has_id()) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_id());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string label = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_label());
+    }
+
+    // optional string note = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_note());
+    }
+
+    // optional string owner = 11;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_owner());
+    }
+
+    // optional string region = 15;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_region());
+    }
+
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    // optional double score = 3;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int64 total = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_total());
+    }
+
+    // optional int32 count = 2;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_count());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional float ratio = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 4;
+    }
+
+    // optional sint64 delta = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_delta());
+    }
+
+    // optional uint32 level = 9;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_level());
+    }
+
+    // optional bool flag = 6;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool active = 16;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 + 1;
+    }
+
+    // optional double weight = 12;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed64 stamp = 14;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 rank = 13;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_rank());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BenchRow16::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BenchRow16::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BenchRow16::GetClassData() const { return &_class_data_; }
+
+
+void BenchRow16::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BenchRow16*>(&to_msg);
+  auto& from = static_cast<const BenchRow16&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PROTO.BenchRow16)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_label(from._internal_label());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_note(from._internal_note());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_owner(from._internal_owner());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_region(from._internal_region());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.id_ = from._impl_.id_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.score_ = from._impl_.score_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.total_ = from._impl_.total_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.ratio_ = from._impl_.ratio_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.delta_ = from._impl_.delta_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.level_ = from._impl_.level_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.flag_ = from._impl_.flag_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.active_ = from._impl_.active_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.weight_ = from._impl_.weight_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.stamp_ = from._impl_.stamp_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.rank_ = from._impl_.rank_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BenchRow16::CopyFrom(const BenchRow16& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PROTO.BenchRow16)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BenchRow16::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void BenchRow16::InternalSwap(BenchRow16* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.label_, lhs_arena,
+      &other->_impl_.label_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.note_, lhs_arena,
+      &other->_impl_.note_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.owner_, lhs_arena,
+      &other->_impl_.owner_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.region_, lhs_arena,
+      &other->_impl_.region_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BenchRow16, _impl_.rank_)
+      + sizeof(BenchRow16::_impl_.rank_)
+      - PROTOBUF_FIELD_OFFSET(BenchRow16, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BenchRow16::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_bench_2eproto_getter, &descriptor_table_bench_2eproto_once,
+      file_level_metadata_bench_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace PROTO
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::PROTO::BenchRow4*
+Arena::CreateMaybeMessage< ::PROTO::BenchRow4 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PROTO::BenchRow4 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PROTO::BenchRow8*
+Arena::CreateMaybeMessage< ::PROTO::BenchRow8 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PROTO::BenchRow8 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::PROTO::BenchRow16*
+Arena::CreateMaybeMessage< ::PROTO::BenchRow16 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PROTO::BenchRow16 >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
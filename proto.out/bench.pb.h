@@ -0,0 +1,2053 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: bench.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_bench_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_bench_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_bench_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_bench_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_bench_2eproto;
+namespace PROTO {
+class BenchRow16;
+struct BenchRow16DefaultTypeInternal;
+extern BenchRow16DefaultTypeInternal _BenchRow16_default_instance_;
+class BenchRow4;
+struct BenchRow4DefaultTypeInternal;
+extern BenchRow4DefaultTypeInternal _BenchRow4_default_instance_;
+class BenchRow8;
+struct BenchRow8DefaultTypeInternal;
+extern BenchRow8DefaultTypeInternal _BenchRow8_default_instance_;
+}  // namespace PROTO
+PROTOBUF_NAMESPACE_OPEN
+template<> ::PROTO::BenchRow16* Arena::CreateMaybeMessage<::PROTO::BenchRow16>(Arena*);
+template<> ::PROTO::BenchRow4* Arena::CreateMaybeMessage<::PROTO::BenchRow4>(Arena*);
+template<> ::PROTO::BenchRow8* Arena::CreateMaybeMessage<::PROTO::BenchRow8>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace PROTO {
+
+// ===================================================================
+
+class BenchRow4 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PROTO.BenchRow4) */ {
+ public:
+  inline BenchRow4() : BenchRow4(nullptr) {}
+  ~BenchRow4() override;
+  explicit PROTOBUF_CONSTEXPR BenchRow4(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BenchRow4(const BenchRow4& from);
+  BenchRow4(BenchRow4&& from) noexcept
+    : BenchRow4() {
+    *this = ::std::move(from);
+  }
+
+  inline BenchRow4& operator=(const BenchRow4& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BenchRow4& operator=(BenchRow4&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BenchRow4& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BenchRow4* internal_default_instance() {
+    return reinterpret_cast<const BenchRow4*>(
+               &_BenchRow4_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(BenchRow4& a, BenchRow4& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BenchRow4* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BenchRow4* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BenchRow4* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BenchRow4>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BenchRow4& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BenchRow4& from) {
+    BenchRow4::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BenchRow4* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PROTO.BenchRow4";
+  }
+  protected:
+  explicit BenchRow4(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLabelFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kScoreFieldNumber = 3,
+    kCountFieldNumber = 2,
+  };
+  // optional string label = 4;
+  bool has_label() const;
+  private:
+  bool _internal_has_label() const;
+  public:
+  void clear_label();
+  const std::string& label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_label();
+  PROTOBUF_NODISCARD std::string* release_label();
+  void set_allocated_label(std::string* label);
+  private:
+  const std::string& _internal_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_label(const std::string& value);
+  std::string* _internal_mutable_label();
+  public:
+
+  // required int64 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int64_t id() const;
+  void set_id(int64_t value);
+  private:
+  int64_t _internal_id() const;
+  void _internal_set_id(int64_t value);
+  public:
+
+  // optional double score = 3;
+  bool has_score() const;
+  private:
+  bool _internal_has_score() const;
+  public:
+  void clear_score();
+  double score() const;
+  void set_score(double value);
+  private:
+  double _internal_score() const;
+  void _internal_set_score(double value);
+  public:
+
+  // optional int32 count = 2;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PROTO.BenchRow4)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
+    int64_t id_;
+    double score_;
+    int32_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_bench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BenchRow8 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PROTO.BenchRow8) */ {
+ public:
+  inline BenchRow8() : BenchRow8(nullptr) {}
+  ~BenchRow8() override;
+  explicit PROTOBUF_CONSTEXPR BenchRow8(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BenchRow8(const BenchRow8& from);
+  BenchRow8(BenchRow8&& from) noexcept
+    : BenchRow8() {
+    *this = ::std::move(from);
+  }
+
+  inline BenchRow8& operator=(const BenchRow8& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BenchRow8& operator=(BenchRow8&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BenchRow8& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BenchRow8* internal_default_instance() {
+    return reinterpret_cast<const BenchRow8*>(
+               &_BenchRow8_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(BenchRow8& a, BenchRow8& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BenchRow8* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BenchRow8* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BenchRow8* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BenchRow8>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BenchRow8& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BenchRow8& from) {
+    BenchRow8::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BenchRow8* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PROTO.BenchRow8";
+  }
+  protected:
+  explicit BenchRow8(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLabelFieldNumber = 4,
+    kNoteFieldNumber = 7,
+    kIdFieldNumber = 1,
+    kScoreFieldNumber = 3,
+    kCountFieldNumber = 2,
+    kFlagFieldNumber = 6,
+    kTotalFieldNumber = 5,
+    kRatioFieldNumber = 8,
+  };
+  // optional string label = 4;
+  bool has_label() const;
+  private:
+  bool _internal_has_label() const;
+  public:
+  void clear_label();
+  const std::string& label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_label();
+  PROTOBUF_NODISCARD std::string* release_label();
+  void set_allocated_label(std::string* label);
+  private:
+  const std::string& _internal_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_label(const std::string& value);
+  std::string* _internal_mutable_label();
+  public:
+
+  // optional string note = 7;
+  bool has_note() const;
+  private:
+  bool _internal_has_note() const;
+  public:
+  void clear_note();
+  const std::string& note() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_note(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_note();
+  PROTOBUF_NODISCARD std::string* release_note();
+  void set_allocated_note(std::string* note);
+  private:
+  const std::string& _internal_note() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_note(const std::string& value);
+  std::string* _internal_mutable_note();
+  public:
+
+  // required int64 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int64_t id() const;
+  void set_id(int64_t value);
+  private:
+  int64_t _internal_id() const;
+  void _internal_set_id(int64_t value);
+  public:
+
+  // optional double score = 3;
+  bool has_score() const;
+  private:
+  bool _internal_has_score() const;
+  public:
+  void clear_score();
+  double score() const;
+  void set_score(double value);
+  private:
+  double _internal_score() const;
+  void _internal_set_score(double value);
+  public:
+
+  // optional int32 count = 2;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
+
+  // optional bool flag = 6;
+  bool has_flag() const;
+  private:
+  bool _internal_has_flag() const;
+  public:
+  void clear_flag();
+  bool flag() const;
+  void set_flag(bool value);
+  private:
+  bool _internal_flag() const;
+  void _internal_set_flag(bool value);
+  public:
+
+  // optional int64 total = 5;
+  bool has_total() const;
+  private:
+  bool _internal_has_total() const;
+  public:
+  void clear_total();
+  int64_t total() const;
+  void set_total(int64_t value);
+  private:
+  int64_t _internal_total() const;
+  void _internal_set_total(int64_t value);
+  public:
+
+  // optional float ratio = 8;
+  bool has_ratio() const;
+  private:
+  bool _internal_has_ratio() const;
+  public:
+  void clear_ratio();
+  float ratio() const;
+  void set_ratio(float value);
+  private:
+  float _internal_ratio() const;
+  void _internal_set_ratio(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PROTO.BenchRow8)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr note_;
+    int64_t id_;
+    double score_;
+    int32_t count_;
+    bool flag_;
+    int64_t total_;
+    float ratio_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_bench_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BenchRow16 final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PROTO.BenchRow16) */ {
+ public:
+  inline BenchRow16() : BenchRow16(nullptr) {}
+  ~BenchRow16() override;
+  explicit PROTOBUF_CONSTEXPR BenchRow16(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BenchRow16(const BenchRow16& from);
+  BenchRow16(BenchRow16&& from) noexcept
+    : BenchRow16() {
+    *this = ::std::move(from);
+  }
+
+  inline BenchRow16& operator=(const BenchRow16& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BenchRow16& operator=(BenchRow16&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BenchRow16& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BenchRow16* internal_default_instance() {
+    return reinterpret_cast<const BenchRow16*>(
+               &_BenchRow16_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(BenchRow16& a, BenchRow16& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BenchRow16* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BenchRow16* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BenchRow16* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BenchRow16>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BenchRow16& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BenchRow16& from) {
+    BenchRow16::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BenchRow16* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PROTO.BenchRow16";
+  }
+  protected:
+  explicit BenchRow16(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLabelFieldNumber = 4,
+    kNoteFieldNumber = 7,
+    kOwnerFieldNumber = 11,
+    kRegionFieldNumber = 15,
+    kIdFieldNumber = 1,
+    kScoreFieldNumber = 3,
+    kTotalFieldNumber = 5,
+    kCountFieldNumber = 2,
+    kRatioFieldNumber = 8,
+    kDeltaFieldNumber = 10,
+    kLevelFieldNumber = 9,
+    kFlagFieldNumber = 6,
+    kActiveFieldNumber = 16,
+    kWeightFieldNumber = 12,
+    kStampFieldNumber = 14,
+    kRankFieldNumber = 13,
+  };
+  // optional string label = 4;
+  bool has_label() const;
+  private:
+  bool _internal_has_label() const;
+  public:
+  void clear_label();
+  const std::string& label() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_label(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_label();
+  PROTOBUF_NODISCARD std::string* release_label();
+  void set_allocated_label(std::string* label);
+  private:
+  const std::string& _internal_label() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_label(const std::string& value);
+  std::string* _internal_mutable_label();
+  public:
+
+  // optional string note = 7;
+  bool has_note() const;
+  private:
+  bool _internal_has_note() const;
+  public:
+  void clear_note();
+  const std::string& note() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_note(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_note();
+  PROTOBUF_NODISCARD std::string* release_note();
+  void set_allocated_note(std::string* note);
+  private:
+  const std::string& _internal_note() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_note(const std::string& value);
+  std::string* _internal_mutable_note();
+  public:
+
+  // optional string owner = 11;
+  bool has_owner() const;
+  private:
+  bool _internal_has_owner() const;
+  public:
+  void clear_owner();
+  const std::string& owner() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_owner(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_owner();
+  PROTOBUF_NODISCARD std::string* release_owner();
+  void set_allocated_owner(std::string* owner);
+  private:
+  const std::string& _internal_owner() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_owner(const std::string& value);
+  std::string* _internal_mutable_owner();
+  public:
+
+  // optional string region = 15;
+  bool has_region() const;
+  private:
+  bool _internal_has_region() const;
+  public:
+  void clear_region();
+  const std::string& region() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_region(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_region();
+  PROTOBUF_NODISCARD std::string* release_region();
+  void set_allocated_region(std::string* region);
+  private:
+  const std::string& _internal_region() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_region(const std::string& value);
+  std::string* _internal_mutable_region();
+  public:
+
+  // required int64 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int64_t id() const;
+  void set_id(int64_t value);
+  private:
+  int64_t _internal_id() const;
+  void _internal_set_id(int64_t value);
+  public:
+
+  // optional double score = 3;
+  bool has_score() const;
+  private:
+  bool _internal_has_score() const;
+  public:
+  void clear_score();
+  double score() const;
+  void set_score(double value);
+  private:
+  double _internal_score() const;
+  void _internal_set_score(double value);
+  public:
+
+  // optional int64 total = 5;
+  bool has_total() const;
+  private:
+  bool _internal_has_total() const;
+  public:
+  void clear_total();
+  int64_t total() const;
+  void set_total(int64_t value);
+  private:
+  int64_t _internal_total() const;
+  void _internal_set_total(int64_t value);
+  public:
+
+  // optional int32 count = 2;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
+
+  // optional float ratio = 8;
+  bool has_ratio() const;
+  private:
+  bool _internal_has_ratio() const;
+  public:
+  void clear_ratio();
+  float ratio() const;
+  void set_ratio(float value);
+  private:
+  float _internal_ratio() const;
+  void _internal_set_ratio(float value);
+  public:
+
+  // optional sint64 delta = 10;
+  bool has_delta() const;
+  private:
+  bool _internal_has_delta() const;
+  public:
+  void clear_delta();
+  int64_t delta() const;
+  void set_delta(int64_t value);
+  private:
+  int64_t _internal_delta() const;
+  void _internal_set_delta(int64_t value);
+  public:
+
+  // optional uint32 level = 9;
+  bool has_level() const;
+  private:
+  bool _internal_has_level() const;
+  public:
+  void clear_level();
+  uint32_t level() const;
+  void set_level(uint32_t value);
+  private:
+  uint32_t _internal_level() const;
+  void _internal_set_level(uint32_t value);
+  public:
+
+  // optional bool flag = 6;
+  bool has_flag() const;
+  private:
+  bool _internal_has_flag() const;
+  public:
+  void clear_flag();
+  bool flag() const;
+  void set_flag(bool value);
+  private:
+  bool _internal_flag() const;
+  void _internal_set_flag(bool value);
+  public:
+
+  // optional bool active = 16;
+  bool has_active() const;
+  private:
+  bool _internal_has_active() const;
+  public:
+  void clear_active();
+  bool active() const;
+  void set_active(bool value);
+  private:
+  bool _internal_active() const;
+  void _internal_set_active(bool value);
+  public:
+
+  // optional double weight = 12;
+  bool has_weight() const;
+  private:
+  bool _internal_has_weight() const;
+  public:
+  void clear_weight();
+  double weight() const;
+  void set_weight(double value);
+  private:
+  double _internal_weight() const;
+  void _internal_set_weight(double value);
+  public:
+
+  // optional fixed64 stamp = 14;
+  bool has_stamp() const;
+  private:
+  bool _internal_has_stamp() const;
+  public:
+  void clear_stamp();
+  uint64_t stamp() const;
+  void set_stamp(uint64_t value);
+  private:
+  uint64_t _internal_stamp() const;
+  void _internal_set_stamp(uint64_t value);
+  public:
+
+  // optional int32 rank = 13;
+  bool has_rank() const;
+  private:
+  bool _internal_has_rank() const;
+  public:
+  void clear_rank();
+  int32_t rank() const;
+  void set_rank(int32_t value);
+  private:
+  int32_t _internal_rank() const;
+  void _internal_set_rank(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PROTO.BenchRow16)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr label_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr note_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr owner_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr region_;
+    int64_t id_;
+    double score_;
+    int64_t total_;
+    int32_t count_;
+    float ratio_;
+    int64_t delta_;
+    uint32_t level_;
+    bool flag_;
+    bool active_;
+    double weight_;
+    uint64_t stamp_;
+    int32_t rank_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_bench_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// BenchRow4
+
+// required int64 id = 1;
+inline bool BenchRow4::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BenchRow4::has_id() const {
+  return _internal_has_id();
+}
+inline void BenchRow4::clear_id() {
+  _impl_.id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t BenchRow4::_internal_id() const {
+  return _impl_.id_;
+}
+inline int64_t BenchRow4::id() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow4.id)
+  return _internal_id();
+}
+inline void BenchRow4::_internal_set_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void BenchRow4::set_id(int64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow4.id)
+}
+
+// optional int32 count = 2;
+inline bool BenchRow4::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool BenchRow4::has_count() const {
+  return _internal_has_count();
+}
+inline void BenchRow4::clear_count() {
+  _impl_.count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t BenchRow4::_internal_count() const {
+  return _impl_.count_;
+}
+inline int32_t BenchRow4::count() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow4.count)
+  return _internal_count();
+}
+inline void BenchRow4::_internal_set_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.count_ = value;
+}
+inline void BenchRow4::set_count(int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow4.count)
+}
+
+// optional double score = 3;
+inline bool BenchRow4::_internal_has_score() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool BenchRow4::has_score() const {
+  return _internal_has_score();
+}
+inline void BenchRow4::clear_score() {
+  _impl_.score_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double BenchRow4::_internal_score() const {
+  return _impl_.score_;
+}
+inline double BenchRow4::score() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow4.score)
+  return _internal_score();
+}
+inline void BenchRow4::_internal_set_score(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.score_ = value;
+}
+inline void BenchRow4::set_score(double value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow4.score)
+}
+
+// optional string label = 4;
+inline bool BenchRow4::_internal_has_label() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BenchRow4::has_label() const {
+  return _internal_has_label();
+}
+inline void BenchRow4::clear_label() {
+  _impl_.label_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BenchRow4::label() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow4.label)
+  return _internal_label();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRow4::set_label(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow4.label)
+}
+inline std::string* BenchRow4::mutable_label() {
+  std::string* _s = _internal_mutable_label();
+  // @@protoc_insertion_point(field_mutable:PROTO.BenchRow4.label)
+  return _s;
+}
+inline const std::string& BenchRow4::_internal_label() const {
+  return _impl_.label_.Get();
+}
+inline void BenchRow4::_internal_set_label(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRow4::_internal_mutable_label() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRow4::release_label() {
+  // @@protoc_insertion_point(field_release:PROTO.BenchRow4.label)
+  if (!_internal_has_label()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.label_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BenchRow4::set_allocated_label(std::string* label) {
+  if (label != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.label_.SetAllocated(label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.BenchRow4.label)
+}
+
+// -------------------------------------------------------------------
+
+// BenchRow8
+
+// required int64 id = 1;
+inline bool BenchRow8::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_id() const {
+  return _internal_has_id();
+}
+inline void BenchRow8::clear_id() {
+  _impl_.id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int64_t BenchRow8::_internal_id() const {
+  return _impl_.id_;
+}
+inline int64_t BenchRow8::id() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.id)
+  return _internal_id();
+}
+inline void BenchRow8::_internal_set_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.id_ = value;
+}
+inline void BenchRow8::set_id(int64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.id)
+}
+
+// optional int32 count = 2;
+inline bool BenchRow8::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_count() const {
+  return _internal_has_count();
+}
+inline void BenchRow8::clear_count() {
+  _impl_.count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t BenchRow8::_internal_count() const {
+  return _impl_.count_;
+}
+inline int32_t BenchRow8::count() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.count)
+  return _internal_count();
+}
+inline void BenchRow8::_internal_set_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.count_ = value;
+}
+inline void BenchRow8::set_count(int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.count)
+}
+
+// optional double score = 3;
+inline bool BenchRow8::_internal_has_score() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_score() const {
+  return _internal_has_score();
+}
+inline void BenchRow8::clear_score() {
+  _impl_.score_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double BenchRow8::_internal_score() const {
+  return _impl_.score_;
+}
+inline double BenchRow8::score() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.score)
+  return _internal_score();
+}
+inline void BenchRow8::_internal_set_score(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.score_ = value;
+}
+inline void BenchRow8::set_score(double value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.score)
+}
+
+// optional string label = 4;
+inline bool BenchRow8::_internal_has_label() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_label() const {
+  return _internal_has_label();
+}
+inline void BenchRow8::clear_label() {
+  _impl_.label_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BenchRow8::label() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.label)
+  return _internal_label();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRow8::set_label(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.label)
+}
+inline std::string* BenchRow8::mutable_label() {
+  std::string* _s = _internal_mutable_label();
+  // @@protoc_insertion_point(field_mutable:PROTO.BenchRow8.label)
+  return _s;
+}
+inline const std::string& BenchRow8::_internal_label() const {
+  return _impl_.label_.Get();
+}
+inline void BenchRow8::_internal_set_label(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRow8::_internal_mutable_label() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRow8::release_label() {
+  // @@protoc_insertion_point(field_release:PROTO.BenchRow8.label)
+  if (!_internal_has_label()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.label_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BenchRow8::set_allocated_label(std::string* label) {
+  if (label != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.label_.SetAllocated(label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.BenchRow8.label)
+}
+
+// optional int64 total = 5;
+inline bool BenchRow8::_internal_has_total() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_total() const {
+  return _internal_has_total();
+}
+inline void BenchRow8::clear_total() {
+  _impl_.total_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int64_t BenchRow8::_internal_total() const {
+  return _impl_.total_;
+}
+inline int64_t BenchRow8::total() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.total)
+  return _internal_total();
+}
+inline void BenchRow8::_internal_set_total(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.total_ = value;
+}
+inline void BenchRow8::set_total(int64_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.total)
+}
+
+// optional bool flag = 6;
+inline bool BenchRow8::_internal_has_flag() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_flag() const {
+  return _internal_has_flag();
+}
+inline void BenchRow8::clear_flag() {
+  _impl_.flag_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool BenchRow8::_internal_flag() const {
+  return _impl_.flag_;
+}
+inline bool BenchRow8::flag() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.flag)
+  return _internal_flag();
+}
+inline void BenchRow8::_internal_set_flag(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.flag_ = value;
+}
+inline void BenchRow8::set_flag(bool value) {
+  _internal_set_flag(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.flag)
+}
+
+// optional string note = 7;
+inline bool BenchRow8::_internal_has_note() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_note() const {
+  return _internal_has_note();
+}
+inline void BenchRow8::clear_note() {
+  _impl_.note_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& BenchRow8::note() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.note)
+  return _internal_note();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRow8::set_note(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.note_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.note)
+}
+inline std::string* BenchRow8::mutable_note() {
+  std::string* _s = _internal_mutable_note();
+  // @@protoc_insertion_point(field_mutable:PROTO.BenchRow8.note)
+  return _s;
+}
+inline const std::string& BenchRow8::_internal_note() const {
+  return _impl_.note_.Get();
+}
+inline void BenchRow8::_internal_set_note(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.note_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRow8::_internal_mutable_note() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.note_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRow8::release_note() {
+  // @@protoc_insertion_point(field_release:PROTO.BenchRow8.note)
+  if (!_internal_has_note()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.note_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.note_.IsDefault()) {
+    _impl_.note_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BenchRow8::set_allocated_note(std::string* note) {
+  if (note != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.note_.SetAllocated(note, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.note_.IsDefault()) {
+    _impl_.note_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.BenchRow8.note)
+}
+
+// optional float ratio = 8;
+inline bool BenchRow8::_internal_has_ratio() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool BenchRow8::has_ratio() const {
+  return _internal_has_ratio();
+}
+inline void BenchRow8::clear_ratio() {
+  _impl_.ratio_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline float BenchRow8::_internal_ratio() const {
+  return _impl_.ratio_;
+}
+inline float BenchRow8::ratio() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow8.ratio)
+  return _internal_ratio();
+}
+inline void BenchRow8::_internal_set_ratio(float value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.ratio_ = value;
+}
+inline void BenchRow8::set_ratio(float value) {
+  _internal_set_ratio(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow8.ratio)
+}
+
+// -------------------------------------------------------------------
+
+// BenchRow16
+
+// required int64 id = 1;
+inline bool BenchRow16::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_id() const {
+  return _internal_has_id();
+}
+inline void BenchRow16::clear_id() {
+  _impl_.id_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int64_t BenchRow16::_internal_id() const {
+  return _impl_.id_;
+}
+inline int64_t BenchRow16::id() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.id)
+  return _internal_id();
+}
+inline void BenchRow16::_internal_set_id(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.id_ = value;
+}
+inline void BenchRow16::set_id(int64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.id)
+}
+
+// optional int32 count = 2;
+inline bool BenchRow16::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_count() const {
+  return _internal_has_count();
+}
+inline void BenchRow16::clear_count() {
+  _impl_.count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline int32_t BenchRow16::_internal_count() const {
+  return _impl_.count_;
+}
+inline int32_t BenchRow16::count() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.count)
+  return _internal_count();
+}
+inline void BenchRow16::_internal_set_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.count_ = value;
+}
+inline void BenchRow16::set_count(int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.count)
+}
+
+// optional double score = 3;
+inline bool BenchRow16::_internal_has_score() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_score() const {
+  return _internal_has_score();
+}
+inline void BenchRow16::clear_score() {
+  _impl_.score_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double BenchRow16::_internal_score() const {
+  return _impl_.score_;
+}
+inline double BenchRow16::score() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.score)
+  return _internal_score();
+}
+inline void BenchRow16::_internal_set_score(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.score_ = value;
+}
+inline void BenchRow16::set_score(double value) {
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.score)
+}
+
+// optional string label = 4;
+inline bool BenchRow16::_internal_has_label() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_label() const {
+  return _internal_has_label();
+}
+inline void BenchRow16::clear_label() {
+  _impl_.label_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BenchRow16::label() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.label)
+  return _internal_label();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRow16::set_label(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.label_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.label)
+}
+inline std::string* BenchRow16::mutable_label() {
+  std::string* _s = _internal_mutable_label();
+  // @@protoc_insertion_point(field_mutable:PROTO.BenchRow16.label)
+  return _s;
+}
+inline const std::string& BenchRow16::_internal_label() const {
+  return _impl_.label_.Get();
+}
+inline void BenchRow16::_internal_set_label(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.label_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRow16::_internal_mutable_label() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.label_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRow16::release_label() {
+  // @@protoc_insertion_point(field_release:PROTO.BenchRow16.label)
+  if (!_internal_has_label()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.label_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BenchRow16::set_allocated_label(std::string* label) {
+  if (label != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.label_.SetAllocated(label, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.label_.IsDefault()) {
+    _impl_.label_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.BenchRow16.label)
+}
+
+// optional int64 total = 5;
+inline bool BenchRow16::_internal_has_total() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_total() const {
+  return _internal_has_total();
+}
+inline void BenchRow16::clear_total() {
+  _impl_.total_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline int64_t BenchRow16::_internal_total() const {
+  return _impl_.total_;
+}
+inline int64_t BenchRow16::total() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.total)
+  return _internal_total();
+}
+inline void BenchRow16::_internal_set_total(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.total_ = value;
+}
+inline void BenchRow16::set_total(int64_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.total)
+}
+
+// optional bool flag = 6;
+inline bool BenchRow16::_internal_has_flag() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_flag() const {
+  return _internal_has_flag();
+}
+inline void BenchRow16::clear_flag() {
+  _impl_.flag_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool BenchRow16::_internal_flag() const {
+  return _impl_.flag_;
+}
+inline bool BenchRow16::flag() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.flag)
+  return _internal_flag();
+}
+inline void BenchRow16::_internal_set_flag(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.flag_ = value;
+}
+inline void BenchRow16::set_flag(bool value) {
+  _internal_set_flag(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.flag)
+}
+
+// optional string note = 7;
+inline bool BenchRow16::_internal_has_note() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_note() const {
+  return _internal_has_note();
+}
+inline void BenchRow16::clear_note() {
+  _impl_.note_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& BenchRow16::note() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.note)
+  return _internal_note();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRow16::set_note(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.note_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.note)
+}
+inline std::string* BenchRow16::mutable_note() {
+  std::string* _s = _internal_mutable_note();
+  // @@protoc_insertion_point(field_mutable:PROTO.BenchRow16.note)
+  return _s;
+}
+inline const std::string& BenchRow16::_internal_note() const {
+  return _impl_.note_.Get();
+}
+inline void BenchRow16::_internal_set_note(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.note_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRow16::_internal_mutable_note() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.note_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRow16::release_note() {
+  // @@protoc_insertion_point(field_release:PROTO.BenchRow16.note)
+  if (!_internal_has_note()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.note_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.note_.IsDefault()) {
+    _impl_.note_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BenchRow16::set_allocated_note(std::string* note) {
+  if (note != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.note_.SetAllocated(note, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.note_.IsDefault()) {
+    _impl_.note_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.BenchRow16.note)
+}
+
+// optional float ratio = 8;
+inline bool BenchRow16::_internal_has_ratio() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_ratio() const {
+  return _internal_has_ratio();
+}
+inline void BenchRow16::clear_ratio() {
+  _impl_.ratio_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline float BenchRow16::_internal_ratio() const {
+  return _impl_.ratio_;
+}
+inline float BenchRow16::ratio() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.ratio)
+  return _internal_ratio();
+}
+inline void BenchRow16::_internal_set_ratio(float value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.ratio_ = value;
+}
+inline void BenchRow16::set_ratio(float value) {
+  _internal_set_ratio(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.ratio)
+}
+
+// optional uint32 level = 9;
+inline bool BenchRow16::_internal_has_level() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_level() const {
+  return _internal_has_level();
+}
+inline void BenchRow16::clear_level() {
+  _impl_.level_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t BenchRow16::_internal_level() const {
+  return _impl_.level_;
+}
+inline uint32_t BenchRow16::level() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.level)
+  return _internal_level();
+}
+inline void BenchRow16::_internal_set_level(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.level_ = value;
+}
+inline void BenchRow16::set_level(uint32_t value) {
+  _internal_set_level(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.level)
+}
+
+// optional sint64 delta = 10;
+inline bool BenchRow16::_internal_has_delta() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_delta() const {
+  return _internal_has_delta();
+}
+inline void BenchRow16::clear_delta() {
+  _impl_.delta_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline int64_t BenchRow16::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline int64_t BenchRow16::delta() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.delta)
+  return _internal_delta();
+}
+inline void BenchRow16::_internal_set_delta(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.delta_ = value;
+}
+inline void BenchRow16::set_delta(int64_t value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.delta)
+}
+
+// optional string owner = 11;
+inline bool BenchRow16::_internal_has_owner() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_owner() const {
+  return _internal_has_owner();
+}
+inline void BenchRow16::clear_owner() {
+  _impl_.owner_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& BenchRow16::owner() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.owner)
+  return _internal_owner();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRow16::set_owner(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.owner_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.owner)
+}
+inline std::string* BenchRow16::mutable_owner() {
+  std::string* _s = _internal_mutable_owner();
+  // @@protoc_insertion_point(field_mutable:PROTO.BenchRow16.owner)
+  return _s;
+}
+inline const std::string& BenchRow16::_internal_owner() const {
+  return _impl_.owner_.Get();
+}
+inline void BenchRow16::_internal_set_owner(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.owner_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRow16::_internal_mutable_owner() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.owner_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRow16::release_owner() {
+  // @@protoc_insertion_point(field_release:PROTO.BenchRow16.owner)
+  if (!_internal_has_owner()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.owner_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BenchRow16::set_allocated_owner(std::string* owner) {
+  if (owner != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.owner_.SetAllocated(owner, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.owner_.IsDefault()) {
+    _impl_.owner_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.BenchRow16.owner)
+}
+
+// optional double weight = 12;
+inline bool BenchRow16::_internal_has_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_weight() const {
+  return _internal_has_weight();
+}
+inline void BenchRow16::clear_weight() {
+  _impl_.weight_ = 0;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline double BenchRow16::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline double BenchRow16::weight() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.weight)
+  return _internal_weight();
+}
+inline void BenchRow16::_internal_set_weight(double value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.weight_ = value;
+}
+inline void BenchRow16::set_weight(double value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.weight)
+}
+
+// optional int32 rank = 13;
+inline bool BenchRow16::_internal_has_rank() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_rank() const {
+  return _internal_has_rank();
+}
+inline void BenchRow16::clear_rank() {
+  _impl_.rank_ = 0;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline int32_t BenchRow16::_internal_rank() const {
+  return _impl_.rank_;
+}
+inline int32_t BenchRow16::rank() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.rank)
+  return _internal_rank();
+}
+inline void BenchRow16::_internal_set_rank(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.rank_ = value;
+}
+inline void BenchRow16::set_rank(int32_t value) {
+  _internal_set_rank(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.rank)
+}
+
+// optional fixed64 stamp = 14;
+inline bool BenchRow16::_internal_has_stamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_stamp() const {
+  return _internal_has_stamp();
+}
+inline void BenchRow16::clear_stamp() {
+  _impl_.stamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline uint64_t BenchRow16::_internal_stamp() const {
+  return _impl_.stamp_;
+}
+inline uint64_t BenchRow16::stamp() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.stamp)
+  return _internal_stamp();
+}
+inline void BenchRow16::_internal_set_stamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.stamp_ = value;
+}
+inline void BenchRow16::set_stamp(uint64_t value) {
+  _internal_set_stamp(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.stamp)
+}
+
+// optional string region = 15;
+inline bool BenchRow16::_internal_has_region() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_region() const {
+  return _internal_has_region();
+}
+inline void BenchRow16::clear_region() {
+  _impl_.region_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& BenchRow16::region() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.region)
+  return _internal_region();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BenchRow16::set_region(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.region_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.region)
+}
+inline std::string* BenchRow16::mutable_region() {
+  std::string* _s = _internal_mutable_region();
+  // @@protoc_insertion_point(field_mutable:PROTO.BenchRow16.region)
+  return _s;
+}
+inline const std::string& BenchRow16::_internal_region() const {
+  return _impl_.region_.Get();
+}
+inline void BenchRow16::_internal_set_region(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.region_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BenchRow16::_internal_mutable_region() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.region_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BenchRow16::release_region() {
+  // @@protoc_insertion_point(field_release:PROTO.BenchRow16.region)
+  if (!_internal_has_region()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.region_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.region_.IsDefault()) {
+    _impl_.region_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BenchRow16::set_allocated_region(std::string* region) {
+  if (region != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.region_.SetAllocated(region, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.region_.IsDefault()) {
+    _impl_.region_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.BenchRow16.region)
+}
+
+// optional bool active = 16;
+inline bool BenchRow16::_internal_has_active() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool BenchRow16::has_active() const {
+  return _internal_has_active();
+}
+inline void BenchRow16::clear_active() {
+  _impl_.active_ = false;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline bool BenchRow16::_internal_active() const {
+  return _impl_.active_;
+}
+inline bool BenchRow16::active() const {
+  // @@protoc_insertion_point(field_get:PROTO.BenchRow16.active)
+  return _internal_active();
+}
+inline void BenchRow16::_internal_set_active(bool value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.active_ = value;
+}
+inline void BenchRow16::set_active(bool value) {
+  _internal_set_active(value);
+  // @@protoc_insertion_point(field_set:PROTO.BenchRow16.active)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace PROTO
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_bench_2eproto
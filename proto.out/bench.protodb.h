@@ -0,0 +1,654 @@
+// Generated by protoc-gen-protodb from bench.proto. DO NOT EDIT.
+
+#ifndef PROTODB_GENERATED_BENCH_PROTODB_H
+#define PROTODB_GENERATED_BENCH_PROTODB_H
+
+#include "bench.pb.h"
+#include "proto_db_convertor.hpp"
+
+namespace proto_mapper {
+
+template <> struct ProtoDBCodec<::PROTO::BenchRow4> {
+  static constexpr size_t column_count = 4;
+
+  static void bind_id(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow4 &>(message);
+    sqlite3_bind_int64(stmt, index, (sqlite3_int64)obj.id());
+  }
+
+  static void extract_id(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow4 *>(message);
+      obj->set_id(sqlite3_column_int64(stmt, i));
+    }
+  }
+
+  static void bind_count(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow4 &>(message);
+    sqlite3_bind_int(stmt, index, obj.count());
+  }
+
+  static void extract_count(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow4 *>(message);
+      obj->set_count(sqlite3_column_int(stmt, i));
+    }
+  }
+
+  static void bind_score(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow4 &>(message);
+    sqlite3_bind_double(stmt, index, obj.score());
+  }
+
+  static void extract_score(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow4 *>(message);
+      obj->set_score(sqlite3_column_double(stmt, i));
+    }
+  }
+
+  static void bind_label(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow4 &>(message);
+    sqlite3_bind_text(stmt, index, obj.label().data(), (int)obj.label().size(), SQLITE_STATIC);
+  }
+
+  static void extract_label(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow4 *>(message);
+      obj->mutable_label()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static const ProtoDBCodecColumn *columns() {
+    static const ProtoDBCodecColumn columns[] = {
+        {"id", &bind_id, &extract_id},
+        {"count", &bind_count, &extract_count},
+        {"score", &bind_score, &extract_score},
+        {"label", &bind_label, &extract_label},
+        {nullptr, nullptr, nullptr}};
+    return columns;
+  }
+
+  // binds every column, in columns() order from index 1
+  static void bind(sqlite3_stmt *stmt, const ::PROTO::BenchRow4 &obj) {
+    sqlite3_bind_int64(stmt, 1, (sqlite3_int64)obj.id());
+    sqlite3_bind_int(stmt, 2, obj.count());
+    sqlite3_bind_double(stmt, 3, obj.score());
+    sqlite3_bind_text(stmt, 4, obj.label().data(), (int)obj.label().size(), SQLITE_STATIC);
+  }
+
+  // decodes a row selecting every column in columns() order
+  static void decode(sqlite3_stmt *stmt, ::PROTO::BenchRow4 *obj) {
+    if (sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+      obj->set_id(sqlite3_column_int64(stmt, 0));
+    }
+    if (sqlite3_column_type(stmt, 1) != SQLITE_NULL) {
+      obj->set_count(sqlite3_column_int(stmt, 1));
+    }
+    if (sqlite3_column_type(stmt, 2) != SQLITE_NULL) {
+      obj->set_score(sqlite3_column_double(stmt, 2));
+    }
+    if (sqlite3_column_type(stmt, 3) != SQLITE_NULL) {
+      obj->mutable_label()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 3)), sqlite3_column_bytes(stmt, 3));
+    }
+  }
+};
+
+template <> struct ProtoDBCodec<::PROTO::BenchRow8> {
+  static constexpr size_t column_count = 8;
+
+  static void bind_id(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_int64(stmt, index, (sqlite3_int64)obj.id());
+  }
+
+  static void extract_id(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->set_id(sqlite3_column_int64(stmt, i));
+    }
+  }
+
+  static void bind_count(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_int(stmt, index, obj.count());
+  }
+
+  static void extract_count(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->set_count(sqlite3_column_int(stmt, i));
+    }
+  }
+
+  static void bind_score(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_double(stmt, index, obj.score());
+  }
+
+  static void extract_score(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->set_score(sqlite3_column_double(stmt, i));
+    }
+  }
+
+  static void bind_label(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_text(stmt, index, obj.label().data(), (int)obj.label().size(), SQLITE_STATIC);
+  }
+
+  static void extract_label(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->mutable_label()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_total(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_int64(stmt, index, (sqlite3_int64)obj.total());
+  }
+
+  static void extract_total(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->set_total(sqlite3_column_int64(stmt, i));
+    }
+  }
+
+  static void bind_flag(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_int(stmt, index, obj.flag());
+  }
+
+  static void extract_flag(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->set_flag(sqlite3_column_int(stmt, i) != 0);
+    }
+  }
+
+  static void bind_note(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_text(stmt, index, obj.note().data(), (int)obj.note().size(), SQLITE_STATIC);
+  }
+
+  static void extract_note(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->mutable_note()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_ratio(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow8 &>(message);
+    sqlite3_bind_double(stmt, index, obj.ratio());
+  }
+
+  static void extract_ratio(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow8 *>(message);
+      obj->set_ratio((float)sqlite3_column_double(stmt, i));
+    }
+  }
+
+  static const ProtoDBCodecColumn *columns() {
+    static const ProtoDBCodecColumn columns[] = {
+        {"id", &bind_id, &extract_id},
+        {"count", &bind_count, &extract_count},
+        {"score", &bind_score, &extract_score},
+        {"label", &bind_label, &extract_label},
+        {"total", &bind_total, &extract_total},
+        {"flag", &bind_flag, &extract_flag},
+        {"note", &bind_note, &extract_note},
+        {"ratio", &bind_ratio, &extract_ratio},
+        {nullptr, nullptr, nullptr}};
+    return columns;
+  }
+
+  // binds every column, in columns() order from index 1
+  static void bind(sqlite3_stmt *stmt, const ::PROTO::BenchRow8 &obj) {
+    sqlite3_bind_int64(stmt, 1, (sqlite3_int64)obj.id());
+    sqlite3_bind_int(stmt, 2, obj.count());
+    sqlite3_bind_double(stmt, 3, obj.score());
+    sqlite3_bind_text(stmt, 4, obj.label().data(), (int)obj.label().size(), SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 5, (sqlite3_int64)obj.total());
+    sqlite3_bind_int(stmt, 6, obj.flag());
+    sqlite3_bind_text(stmt, 7, obj.note().data(), (int)obj.note().size(), SQLITE_STATIC);
+    sqlite3_bind_double(stmt, 8, obj.ratio());
+  }
+
+  // decodes a row selecting every column in columns() order
+  static void decode(sqlite3_stmt *stmt, ::PROTO::BenchRow8 *obj) {
+    if (sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+      obj->set_id(sqlite3_column_int64(stmt, 0));
+    }
+    if (sqlite3_column_type(stmt, 1) != SQLITE_NULL) {
+      obj->set_count(sqlite3_column_int(stmt, 1));
+    }
+    if (sqlite3_column_type(stmt, 2) != SQLITE_NULL) {
+      obj->set_score(sqlite3_column_double(stmt, 2));
+    }
+    if (sqlite3_column_type(stmt, 3) != SQLITE_NULL) {
+      obj->mutable_label()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 3)), sqlite3_column_bytes(stmt, 3));
+    }
+    if (sqlite3_column_type(stmt, 4) != SQLITE_NULL) {
+      obj->set_total(sqlite3_column_int64(stmt, 4));
+    }
+    if (sqlite3_column_type(stmt, 5) != SQLITE_NULL) {
+      obj->set_flag(sqlite3_column_int(stmt, 5) != 0);
+    }
+    if (sqlite3_column_type(stmt, 6) != SQLITE_NULL) {
+      obj->mutable_note()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 6)), sqlite3_column_bytes(stmt, 6));
+    }
+    if (sqlite3_column_type(stmt, 7) != SQLITE_NULL) {
+      obj->set_ratio((float)sqlite3_column_double(stmt, 7));
+    }
+  }
+};
+
+template <> struct ProtoDBCodec<::PROTO::BenchRow16> {
+  static constexpr size_t column_count = 16;
+
+  static void bind_id(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int64(stmt, index, (sqlite3_int64)obj.id());
+  }
+
+  static void extract_id(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_id(sqlite3_column_int64(stmt, i));
+    }
+  }
+
+  static void bind_count(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int(stmt, index, obj.count());
+  }
+
+  static void extract_count(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_count(sqlite3_column_int(stmt, i));
+    }
+  }
+
+  static void bind_score(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_double(stmt, index, obj.score());
+  }
+
+  static void extract_score(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_score(sqlite3_column_double(stmt, i));
+    }
+  }
+
+  static void bind_label(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_text(stmt, index, obj.label().data(), (int)obj.label().size(), SQLITE_STATIC);
+  }
+
+  static void extract_label(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->mutable_label()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_total(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int64(stmt, index, (sqlite3_int64)obj.total());
+  }
+
+  static void extract_total(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_total(sqlite3_column_int64(stmt, i));
+    }
+  }
+
+  static void bind_flag(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int(stmt, index, obj.flag());
+  }
+
+  static void extract_flag(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_flag(sqlite3_column_int(stmt, i) != 0);
+    }
+  }
+
+  static void bind_note(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_text(stmt, index, obj.note().data(), (int)obj.note().size(), SQLITE_STATIC);
+  }
+
+  static void extract_note(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->mutable_note()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_ratio(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_double(stmt, index, obj.ratio());
+  }
+
+  static void extract_ratio(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_ratio((float)sqlite3_column_double(stmt, i));
+    }
+  }
+
+  static void bind_level(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int(stmt, index, obj.level());
+  }
+
+  static void extract_level(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_level(sqlite3_column_int(stmt, i));
+    }
+  }
+
+  static void bind_delta(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int64(stmt, index, (sqlite3_int64)obj.delta());
+  }
+
+  static void extract_delta(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_delta(sqlite3_column_int64(stmt, i));
+    }
+  }
+
+  static void bind_owner(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_text(stmt, index, obj.owner().data(), (int)obj.owner().size(), SQLITE_STATIC);
+  }
+
+  static void extract_owner(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->mutable_owner()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_weight(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_double(stmt, index, obj.weight());
+  }
+
+  static void extract_weight(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_weight(sqlite3_column_double(stmt, i));
+    }
+  }
+
+  static void bind_rank(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int(stmt, index, obj.rank());
+  }
+
+  static void extract_rank(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_rank(sqlite3_column_int(stmt, i));
+    }
+  }
+
+  static void bind_stamp(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int64(stmt, index, (sqlite3_int64)obj.stamp());
+  }
+
+  static void extract_stamp(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_stamp(sqlite3_column_int64(stmt, i));
+    }
+  }
+
+  static void bind_region(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_text(stmt, index, obj.region().data(), (int)obj.region().size(), SQLITE_STATIC);
+  }
+
+  static void extract_region(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->mutable_region()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_active(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::BenchRow16 &>(message);
+    sqlite3_bind_int(stmt, index, obj.active());
+  }
+
+  static void extract_active(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::BenchRow16 *>(message);
+      obj->set_active(sqlite3_column_int(stmt, i) != 0);
+    }
+  }
+
+  static const ProtoDBCodecColumn *columns() {
+    static const ProtoDBCodecColumn columns[] = {
+        {"id", &bind_id, &extract_id},
+        {"count", &bind_count, &extract_count},
+        {"score", &bind_score, &extract_score},
+        {"label", &bind_label, &extract_label},
+        {"total", &bind_total, &extract_total},
+        {"flag", &bind_flag, &extract_flag},
+        {"note", &bind_note, &extract_note},
+        {"ratio", &bind_ratio, &extract_ratio},
+        {"level", &bind_level, &extract_level},
+        {"delta", &bind_delta, &extract_delta},
+        {"owner", &bind_owner, &extract_owner},
+        {"weight", &bind_weight, &extract_weight},
+        {"rank", &bind_rank, &extract_rank},
+        {"stamp", &bind_stamp, &extract_stamp},
+        {"region", &bind_region, &extract_region},
+        {"active", &bind_active, &extract_active},
+        {nullptr, nullptr, nullptr}};
+    return columns;
+  }
+
+  // binds every column, in columns() order from index 1
+  static void bind(sqlite3_stmt *stmt, const ::PROTO::BenchRow16 &obj) {
+    sqlite3_bind_int64(stmt, 1, (sqlite3_int64)obj.id());
+    sqlite3_bind_int(stmt, 2, obj.count());
+    sqlite3_bind_double(stmt, 3, obj.score());
+    sqlite3_bind_text(stmt, 4, obj.label().data(), (int)obj.label().size(), SQLITE_STATIC);
+    sqlite3_bind_int64(stmt, 5, (sqlite3_int64)obj.total());
+    sqlite3_bind_int(stmt, 6, obj.flag());
+    sqlite3_bind_text(stmt, 7, obj.note().data(), (int)obj.note().size(), SQLITE_STATIC);
+    sqlite3_bind_double(stmt, 8, obj.ratio());
+    sqlite3_bind_int(stmt, 9, obj.level());
+    sqlite3_bind_int64(stmt, 10, (sqlite3_int64)obj.delta());
+    sqlite3_bind_text(stmt, 11, obj.owner().data(), (int)obj.owner().size(), SQLITE_STATIC);
+    sqlite3_bind_double(stmt, 12, obj.weight());
+    sqlite3_bind_int(stmt, 13, obj.rank());
+    sqlite3_bind_int64(stmt, 14, (sqlite3_int64)obj.stamp());
+    sqlite3_bind_text(stmt, 15, obj.region().data(), (int)obj.region().size(), SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 16, obj.active());
+  }
+
+  // decodes a row selecting every column in columns() order
+  static void decode(sqlite3_stmt *stmt, ::PROTO::BenchRow16 *obj) {
+    if (sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+      obj->set_id(sqlite3_column_int64(stmt, 0));
+    }
+    if (sqlite3_column_type(stmt, 1) != SQLITE_NULL) {
+      obj->set_count(sqlite3_column_int(stmt, 1));
+    }
+    if (sqlite3_column_type(stmt, 2) != SQLITE_NULL) {
+      obj->set_score(sqlite3_column_double(stmt, 2));
+    }
+    if (sqlite3_column_type(stmt, 3) != SQLITE_NULL) {
+      obj->mutable_label()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 3)), sqlite3_column_bytes(stmt, 3));
+    }
+    if (sqlite3_column_type(stmt, 4) != SQLITE_NULL) {
+      obj->set_total(sqlite3_column_int64(stmt, 4));
+    }
+    if (sqlite3_column_type(stmt, 5) != SQLITE_NULL) {
+      obj->set_flag(sqlite3_column_int(stmt, 5) != 0);
+    }
+    if (sqlite3_column_type(stmt, 6) != SQLITE_NULL) {
+      obj->mutable_note()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 6)), sqlite3_column_bytes(stmt, 6));
+    }
+    if (sqlite3_column_type(stmt, 7) != SQLITE_NULL) {
+      obj->set_ratio((float)sqlite3_column_double(stmt, 7));
+    }
+    if (sqlite3_column_type(stmt, 8) != SQLITE_NULL) {
+      obj->set_level(sqlite3_column_int(stmt, 8));
+    }
+    if (sqlite3_column_type(stmt, 9) != SQLITE_NULL) {
+      obj->set_delta(sqlite3_column_int64(stmt, 9));
+    }
+    if (sqlite3_column_type(stmt, 10) != SQLITE_NULL) {
+      obj->mutable_owner()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 10)), sqlite3_column_bytes(stmt, 10));
+    }
+    if (sqlite3_column_type(stmt, 11) != SQLITE_NULL) {
+      obj->set_weight(sqlite3_column_double(stmt, 11));
+    }
+    if (sqlite3_column_type(stmt, 12) != SQLITE_NULL) {
+      obj->set_rank(sqlite3_column_int(stmt, 12));
+    }
+    if (sqlite3_column_type(stmt, 13) != SQLITE_NULL) {
+      obj->set_stamp(sqlite3_column_int64(stmt, 13));
+    }
+    if (sqlite3_column_type(stmt, 14) != SQLITE_NULL) {
+      obj->mutable_region()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 14)), sqlite3_column_bytes(stmt, 14));
+    }
+    if (sqlite3_column_type(stmt, 15) != SQLITE_NULL) {
+      obj->set_active(sqlite3_column_int(stmt, 15) != 0);
+    }
+  }
+};
+
+} // namespace proto_mapper
+#endif // PROTODB_GENERATED_BENCH_PROTODB_H
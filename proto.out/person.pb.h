@@ -0,0 +1,618 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: person.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_person_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_person_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_person_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_person_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_person_2eproto;
+namespace PROTO {
+class Person;
+struct PersonDefaultTypeInternal;
+extern PersonDefaultTypeInternal _Person_default_instance_;
+}  // namespace PROTO
+PROTOBUF_NAMESPACE_OPEN
+template<> ::PROTO::Person* Arena::CreateMaybeMessage<::PROTO::Person>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace PROTO {
+
+// ===================================================================
+
+class Person final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PROTO.Person) */ {
+ public:
+  inline Person() : Person(nullptr) {}
+  ~Person() override;
+  explicit PROTOBUF_CONSTEXPR Person(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Person(const Person& from);
+  Person(Person&& from) noexcept
+    : Person() {
+    *this = ::std::move(from);
+  }
+
+  inline Person& operator=(const Person& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Person& operator=(Person&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Person& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Person* internal_default_instance() {
+    return reinterpret_cast<const Person*>(
+               &_Person_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Person& a, Person& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Person* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Person* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Person* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Person>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Person& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Person& from) {
+    Person::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Person* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PROTO.Person";
+  }
+  protected:
+  explicit Person(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumbersFieldNumber = 3,
+    kAlasFieldNumber = 5,
+    kNameFieldNumber = 1,
+    kTempFieldNumber = 4,
+    kAgeFieldNumber = 2,
+  };
+  // repeated int32 numbers = 3;
+  int numbers_size() const;
+  private:
+  int _internal_numbers_size() const;
+  public:
+  void clear_numbers();
+  private:
+  int32_t _internal_numbers(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_numbers() const;
+  void _internal_add_numbers(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_numbers();
+  public:
+  int32_t numbers(int index) const;
+  void set_numbers(int index, int32_t value);
+  void add_numbers(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      numbers() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_numbers();
+
+  // repeated string alas = 5;
+  int alas_size() const;
+  private:
+  int _internal_alas_size() const;
+  public:
+  void clear_alas();
+  const std::string& alas(int index) const;
+  std::string* mutable_alas(int index);
+  void set_alas(int index, const std::string& value);
+  void set_alas(int index, std::string&& value);
+  void set_alas(int index, const char* value);
+  void set_alas(int index, const char* value, size_t size);
+  std::string* add_alas();
+  void add_alas(const std::string& value);
+  void add_alas(std::string&& value);
+  void add_alas(const char* value);
+  void add_alas(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& alas() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_alas();
+  private:
+  const std::string& _internal_alas(int index) const;
+  std::string* _internal_add_alas();
+  public:
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string temp = 4;
+  bool has_temp() const;
+  private:
+  bool _internal_has_temp() const;
+  public:
+  void clear_temp();
+  const std::string& temp() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_temp(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_temp();
+  PROTOBUF_NODISCARD std::string* release_temp();
+  void set_allocated_temp(std::string* temp);
+  private:
+  const std::string& _internal_temp() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_temp(const std::string& value);
+  std::string* _internal_mutable_temp();
+  public:
+
+  // required int32 age = 2;
+  bool has_age() const;
+  private:
+  bool _internal_has_age() const;
+  public:
+  void clear_age();
+  int32_t age() const;
+  void set_age(int32_t value);
+  private:
+  int32_t _internal_age() const;
+  void _internal_set_age(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PROTO.Person)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > numbers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> alas_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr temp_;
+    int32_t age_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_person_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Person
+
+// required string name = 1;
+inline bool Person::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Person::has_name() const {
+  return _internal_has_name();
+}
+inline void Person::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Person::name() const {
+  // @@protoc_insertion_point(field_get:PROTO.Person.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Person::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.Person.name)
+}
+inline std::string* Person::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:PROTO.Person.name)
+  return _s;
+}
+inline const std::string& Person::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Person::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Person::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Person::release_name() {
+  // @@protoc_insertion_point(field_release:PROTO.Person.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Person::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.Person.name)
+}
+
+// required int32 age = 2;
+inline bool Person::_internal_has_age() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Person::has_age() const {
+  return _internal_has_age();
+}
+inline void Person::clear_age() {
+  _impl_.age_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t Person::_internal_age() const {
+  return _impl_.age_;
+}
+inline int32_t Person::age() const {
+  // @@protoc_insertion_point(field_get:PROTO.Person.age)
+  return _internal_age();
+}
+inline void Person::_internal_set_age(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.age_ = value;
+}
+inline void Person::set_age(int32_t value) {
+  _internal_set_age(value);
+  // @@protoc_insertion_point(field_set:PROTO.Person.age)
+}
+
+// repeated int32 numbers = 3;
+inline int Person::_internal_numbers_size() const {
+  return _impl_.numbers_.size();
+}
+inline int Person::numbers_size() const {
+  return _internal_numbers_size();
+}
+inline void Person::clear_numbers() {
+  _impl_.numbers_.Clear();
+}
+inline int32_t Person::_internal_numbers(int index) const {
+  return _impl_.numbers_.Get(index);
+}
+inline int32_t Person::numbers(int index) const {
+  // @@protoc_insertion_point(field_get:PROTO.Person.numbers)
+  return _internal_numbers(index);
+}
+inline void Person::set_numbers(int index, int32_t value) {
+  _impl_.numbers_.Set(index, value);
+  // @@protoc_insertion_point(field_set:PROTO.Person.numbers)
+}
+inline void Person::_internal_add_numbers(int32_t value) {
+  _impl_.numbers_.Add(value);
+}
+inline void Person::add_numbers(int32_t value) {
+  _internal_add_numbers(value);
+  // @@protoc_insertion_point(field_add:PROTO.Person.numbers)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Person::_internal_numbers() const {
+  return _impl_.numbers_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Person::numbers() const {
+  // @@protoc_insertion_point(field_list:PROTO.Person.numbers)
+  return _internal_numbers();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Person::_internal_mutable_numbers() {
+  return &_impl_.numbers_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Person::mutable_numbers() {
+  // @@protoc_insertion_point(field_mutable_list:PROTO.Person.numbers)
+  return _internal_mutable_numbers();
+}
+
+// optional string temp = 4;
+inline bool Person::_internal_has_temp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Person::has_temp() const {
+  return _internal_has_temp();
+}
+inline void Person::clear_temp() {
+  _impl_.temp_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Person::temp() const {
+  // @@protoc_insertion_point(field_get:PROTO.Person.temp)
+  return _internal_temp();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Person::set_temp(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.temp_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.Person.temp)
+}
+inline std::string* Person::mutable_temp() {
+  std::string* _s = _internal_mutable_temp();
+  // @@protoc_insertion_point(field_mutable:PROTO.Person.temp)
+  return _s;
+}
+inline const std::string& Person::_internal_temp() const {
+  return _impl_.temp_.Get();
+}
+inline void Person::_internal_set_temp(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.temp_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Person::_internal_mutable_temp() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.temp_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Person::release_temp() {
+  // @@protoc_insertion_point(field_release:PROTO.Person.temp)
+  if (!_internal_has_temp()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.temp_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.temp_.IsDefault()) {
+    _impl_.temp_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Person::set_allocated_temp(std::string* temp) {
+  if (temp != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.temp_.SetAllocated(temp, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.temp_.IsDefault()) {
+    _impl_.temp_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.Person.temp)
+}
+
+// repeated string alas = 5;
+inline int Person::_internal_alas_size() const {
+  return _impl_.alas_.size();
+}
+inline int Person::alas_size() const {
+  return _internal_alas_size();
+}
+inline void Person::clear_alas() {
+  _impl_.alas_.Clear();
+}
+inline std::string* Person::add_alas() {
+  std::string* _s = _internal_add_alas();
+  // @@protoc_insertion_point(field_add_mutable:PROTO.Person.alas)
+  return _s;
+}
+inline const std::string& Person::_internal_alas(int index) const {
+  return _impl_.alas_.Get(index);
+}
+inline const std::string& Person::alas(int index) const {
+  // @@protoc_insertion_point(field_get:PROTO.Person.alas)
+  return _internal_alas(index);
+}
+inline std::string* Person::mutable_alas(int index) {
+  // @@protoc_insertion_point(field_mutable:PROTO.Person.alas)
+  return _impl_.alas_.Mutable(index);
+}
+inline void Person::set_alas(int index, const std::string& value) {
+  _impl_.alas_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:PROTO.Person.alas)
+}
+inline void Person::set_alas(int index, std::string&& value) {
+  _impl_.alas_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:PROTO.Person.alas)
+}
+inline void Person::set_alas(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.alas_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:PROTO.Person.alas)
+}
+inline void Person::set_alas(int index, const char* value, size_t size) {
+  _impl_.alas_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:PROTO.Person.alas)
+}
+inline std::string* Person::_internal_add_alas() {
+  return _impl_.alas_.Add();
+}
+inline void Person::add_alas(const std::string& value) {
+  _impl_.alas_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:PROTO.Person.alas)
+}
+inline void Person::add_alas(std::string&& value) {
+  _impl_.alas_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:PROTO.Person.alas)
+}
+inline void Person::add_alas(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.alas_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:PROTO.Person.alas)
+}
+inline void Person::add_alas(const char* value, size_t size) {
+  _impl_.alas_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:PROTO.Person.alas)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Person::alas() const {
+  // @@protoc_insertion_point(field_list:PROTO.Person.alas)
+  return _impl_.alas_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Person::mutable_alas() {
+  // @@protoc_insertion_point(field_mutable_list:PROTO.Person.alas)
+  return &_impl_.alas_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace PROTO
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_person_2eproto
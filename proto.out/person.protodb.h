@@ -0,0 +1,93 @@
+// Generated by protoc-gen-protodb from person.proto. DO NOT EDIT.
+
+#ifndef PROTODB_GENERATED_PERSON_PROTODB_H
+#define PROTODB_GENERATED_PERSON_PROTODB_H
+
+#include "person.pb.h"
+#include "proto_db_convertor.hpp"
+
+namespace proto_mapper {
+
+template <> struct ProtoDBCodec<::PROTO::Person> {
+  static constexpr size_t column_count = 3;
+
+  static void bind_name(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::Person &>(message);
+    sqlite3_bind_text(stmt, index, obj.name().data(), (int)obj.name().size(), SQLITE_STATIC);
+  }
+
+  static void extract_name(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::Person *>(message);
+      obj->mutable_name()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_age(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::Person &>(message);
+    sqlite3_bind_int(stmt, index, obj.age());
+  }
+
+  static void extract_age(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::Person *>(message);
+      obj->set_age(sqlite3_column_int(stmt, i));
+    }
+  }
+
+  static void bind_temp(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::Person &>(message);
+    sqlite3_bind_text(stmt, index, obj.temp().data(), (int)obj.temp().size(), SQLITE_STATIC);
+  }
+
+  static void extract_temp(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::Person *>(message);
+      obj->mutable_temp()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static const ProtoDBCodecColumn *columns() {
+    static const ProtoDBCodecColumn columns[] = {
+        {"name", &bind_name, &extract_name},
+        {"age", &bind_age, &extract_age},
+        {"temp", &bind_temp, &extract_temp},
+        {nullptr, nullptr, nullptr}};
+    return columns;
+  }
+
+  // binds every column, in columns() order from index 1
+  static void bind(sqlite3_stmt *stmt, const ::PROTO::Person &obj) {
+    sqlite3_bind_text(stmt, 1, obj.name().data(), (int)obj.name().size(), SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, obj.age());
+    sqlite3_bind_text(stmt, 3, obj.temp().data(), (int)obj.temp().size(), SQLITE_STATIC);
+  }
+
+  // decodes a row selecting every column in columns() order
+  static void decode(sqlite3_stmt *stmt, ::PROTO::Person *obj) {
+    if (sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+      obj->mutable_name()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)), sqlite3_column_bytes(stmt, 0));
+    }
+    if (sqlite3_column_type(stmt, 1) != SQLITE_NULL) {
+      obj->set_age(sqlite3_column_int(stmt, 1));
+    }
+    if (sqlite3_column_type(stmt, 2) != SQLITE_NULL) {
+      obj->mutable_temp()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 2)), sqlite3_column_bytes(stmt, 2));
+    }
+  }
+};
+
+} // namespace proto_mapper
+#endif // PROTODB_GENERATED_PERSON_PROTODB_H
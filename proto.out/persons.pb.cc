@@ -0,0 +1,417 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: persons.proto
+
+#include "persons.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace PROTO {
+PROTOBUF_CONSTEXPR Persons::Persons(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.people_)*/{}
+  , /*decltype(_impl_.group_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/0} {}
+struct PersonsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PersonsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PersonsDefaultTypeInternal() {}
+  union {
+    Persons _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PersonsDefaultTypeInternal _Persons_default_instance_;
+}  // namespace PROTO
+static ::_pb::Metadata file_level_metadata_persons_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_persons_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_persons_2eproto = nullptr;
+
+const uint32_t TableStruct_persons_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::PROTO::Persons, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::Persons, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PROTO::Persons, _impl_.people_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::Persons, _impl_.group_id_),
+  PROTOBUF_FIELD_OFFSET(::PROTO::Persons, _impl_.count_),
+  ~0u,
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::PROTO::Persons)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::PROTO::_Persons_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_persons_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rpersons.proto\022\005PROTO\032\014person.proto\"I\n\007"
+  "Persons\022\035\n\006people\030\001 \003(\0132\r.PROTO.Person\022\020"
+  "\n\010group_id\030\002 \002(\t\022\r\n\005count\030\003 \002(\005"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_persons_2eproto_deps[1] = {
+  &::descriptor_table_person_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_persons_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_persons_2eproto = {
+    false, false, 111, descriptor_table_protodef_persons_2eproto,
+    "persons.proto",
+    &descriptor_table_persons_2eproto_once, descriptor_table_persons_2eproto_deps, 1, 1,
+    schemas, file_default_instances, TableStruct_persons_2eproto::offsets,
+    file_level_metadata_persons_2eproto, file_level_enum_descriptors_persons_2eproto,
+    file_level_service_descriptors_persons_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_persons_2eproto_getter() {
+  return &descriptor_table_persons_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_persons_2eproto(&descriptor_table_persons_2eproto);
+namespace PROTO {
+
+// ===================================================================
+
+class Persons::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Persons>()._impl_._has_bits_);
+  static void set_has_group_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+void Persons::clear_people() {
+  _impl_.people_.Clear();
+}
+Persons::Persons(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PROTO.Persons)
+}
+Persons::Persons(const Persons& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Persons* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.people_){from._impl_.people_}
+    , decltype(_impl_.group_id_){}
+    , decltype(_impl_.count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.group_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_group_id()) {
+    _this->_impl_.group_id_.Set(from._internal_group_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.count_ = from._impl_.count_;
+  // @@protoc_insertion_point(copy_constructor:PROTO.Persons)
+}
+
+inline void Persons::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.people_){arena}
+    , decltype(_impl_.group_id_){}
+    , decltype(_impl_.count_){0}
+  };
+  _impl_.group_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Persons::~Persons() {
+  // @@protoc_insertion_point(destructor:PROTO.Persons)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Persons::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.people_.~RepeatedPtrField();
+  _impl_.group_id_.Destroy();
+}
+
+void Persons::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Persons::Clear() {
+// @@protoc_insertion_point(message_clear_start:PROTO.Persons)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.people_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.group_id_.ClearNonDefaultToEmpty();
+  }
+  _impl_.count_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Persons::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .PROTO.Person people = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_people(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required string group_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_group_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "PROTO.Persons.group_id");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Persons::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PROTO.Persons)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .PROTO.Person people = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_people_size()); i < n; i++) {
+    const auto& repfield = this->_internal_people(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string group_id = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_group_id().data(), static_cast<int>(this->_internal_group_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "PROTO.Persons.group_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_group_id(), target);
+  }
+
+  // required int32 count = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PROTO.Persons)
+  return target;
+}
+
+size_t Persons::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:PROTO.Persons)
+  size_t total_size = 0;
+
+  if (_internal_has_group_id()) {
+    // required string group_id = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_group_id());
+  }
+
+  if (_internal_has_count()) {
+    // required int32 count = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_count());
+  }
+
+  return total_size;
+}
+size_t Persons::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PROTO.Persons)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string group_id = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_group_id());
+
+    // required int32 count = 3;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_count());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .PROTO.Person people = 1;
+  total_size += 1UL * this->_internal_people_size();
+  for (const auto& msg : this->_impl_.people_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Persons::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Persons::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Persons::GetClassData() const { return &_class_data_; }
+
+
+void Persons::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Persons*>(&to_msg);
+  auto& from = static_cast<const Persons&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PROTO.Persons)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.people_.MergeFrom(from._impl_.people_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_group_id(from._internal_group_id());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Persons::CopyFrom(const Persons& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PROTO.Persons)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Persons::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.people_))
+    return false;
+  return true;
+}
+
+void Persons::InternalSwap(Persons* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.people_.InternalSwap(&other->_impl_.people_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.group_id_, lhs_arena,
+      &other->_impl_.group_id_, rhs_arena
+  );
+  swap(_impl_.count_, other->_impl_.count_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Persons::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_persons_2eproto_getter, &descriptor_table_persons_2eproto_once,
+      file_level_metadata_persons_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace PROTO
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::PROTO::Persons*
+Arena::CreateMaybeMessage< ::PROTO::Persons >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PROTO::Persons >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,416 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: persons.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_persons_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_persons_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "person.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_persons_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_persons_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_persons_2eproto;
+namespace PROTO {
+class Persons;
+struct PersonsDefaultTypeInternal;
+extern PersonsDefaultTypeInternal _Persons_default_instance_;
+}  // namespace PROTO
+PROTOBUF_NAMESPACE_OPEN
+template<> ::PROTO::Persons* Arena::CreateMaybeMessage<::PROTO::Persons>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace PROTO {
+
+// ===================================================================
+
+class Persons final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PROTO.Persons) */ {
+ public:
+  inline Persons() : Persons(nullptr) {}
+  ~Persons() override;
+  explicit PROTOBUF_CONSTEXPR Persons(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Persons(const Persons& from);
+  Persons(Persons&& from) noexcept
+    : Persons() {
+    *this = ::std::move(from);
+  }
+
+  inline Persons& operator=(const Persons& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Persons& operator=(Persons&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Persons& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Persons* internal_default_instance() {
+    return reinterpret_cast<const Persons*>(
+               &_Persons_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Persons& a, Persons& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Persons* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Persons* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Persons* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Persons>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Persons& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Persons& from) {
+    Persons::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Persons* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "PROTO.Persons";
+  }
+  protected:
+  explicit Persons(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPeopleFieldNumber = 1,
+    kGroupIdFieldNumber = 2,
+    kCountFieldNumber = 3,
+  };
+  // repeated .PROTO.Person people = 1;
+  int people_size() const;
+  private:
+  int _internal_people_size() const;
+  public:
+  void clear_people();
+  ::PROTO::Person* mutable_people(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PROTO::Person >*
+      mutable_people();
+  private:
+  const ::PROTO::Person& _internal_people(int index) const;
+  ::PROTO::Person* _internal_add_people();
+  public:
+  const ::PROTO::Person& people(int index) const;
+  ::PROTO::Person* add_people();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PROTO::Person >&
+      people() const;
+
+  // required string group_id = 2;
+  bool has_group_id() const;
+  private:
+  bool _internal_has_group_id() const;
+  public:
+  void clear_group_id();
+  const std::string& group_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_group_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_group_id();
+  PROTOBUF_NODISCARD std::string* release_group_id();
+  void set_allocated_group_id(std::string* group_id);
+  private:
+  const std::string& _internal_group_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_group_id(const std::string& value);
+  std::string* _internal_mutable_group_id();
+  public:
+
+  // required int32 count = 3;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PROTO.Persons)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PROTO::Person > people_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr group_id_;
+    int32_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_persons_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Persons
+
+// repeated .PROTO.Person people = 1;
+inline int Persons::_internal_people_size() const {
+  return _impl_.people_.size();
+}
+inline int Persons::people_size() const {
+  return _internal_people_size();
+}
+inline ::PROTO::Person* Persons::mutable_people(int index) {
+  // @@protoc_insertion_point(field_mutable:PROTO.Persons.people)
+  return _impl_.people_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PROTO::Person >*
+Persons::mutable_people() {
+  // @@protoc_insertion_point(field_mutable_list:PROTO.Persons.people)
+  return &_impl_.people_;
+}
+inline const ::PROTO::Person& Persons::_internal_people(int index) const {
+  return _impl_.people_.Get(index);
+}
+inline const ::PROTO::Person& Persons::people(int index) const {
+  // @@protoc_insertion_point(field_get:PROTO.Persons.people)
+  return _internal_people(index);
+}
+inline ::PROTO::Person* Persons::_internal_add_people() {
+  return _impl_.people_.Add();
+}
+inline ::PROTO::Person* Persons::add_people() {
+  ::PROTO::Person* _add = _internal_add_people();
+  // @@protoc_insertion_point(field_add:PROTO.Persons.people)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::PROTO::Person >&
+Persons::people() const {
+  // @@protoc_insertion_point(field_list:PROTO.Persons.people)
+  return _impl_.people_;
+}
+
+// required string group_id = 2;
+inline bool Persons::_internal_has_group_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Persons::has_group_id() const {
+  return _internal_has_group_id();
+}
+inline void Persons::clear_group_id() {
+  _impl_.group_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Persons::group_id() const {
+  // @@protoc_insertion_point(field_get:PROTO.Persons.group_id)
+  return _internal_group_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Persons::set_group_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.group_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:PROTO.Persons.group_id)
+}
+inline std::string* Persons::mutable_group_id() {
+  std::string* _s = _internal_mutable_group_id();
+  // @@protoc_insertion_point(field_mutable:PROTO.Persons.group_id)
+  return _s;
+}
+inline const std::string& Persons::_internal_group_id() const {
+  return _impl_.group_id_.Get();
+}
+inline void Persons::_internal_set_group_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.group_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Persons::_internal_mutable_group_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.group_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Persons::release_group_id() {
+  // @@protoc_insertion_point(field_release:PROTO.Persons.group_id)
+  if (!_internal_has_group_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.group_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.group_id_.IsDefault()) {
+    _impl_.group_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Persons::set_allocated_group_id(std::string* group_id) {
+  if (group_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.group_id_.SetAllocated(group_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.group_id_.IsDefault()) {
+    _impl_.group_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:PROTO.Persons.group_id)
+}
+
+// required int32 count = 3;
+inline bool Persons::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Persons::has_count() const {
+  return _internal_has_count();
+}
+inline void Persons::clear_count() {
+  _impl_.count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t Persons::_internal_count() const {
+  return _impl_.count_;
+}
+inline int32_t Persons::count() const {
+  // @@protoc_insertion_point(field_get:PROTO.Persons.count)
+  return _internal_count();
+}
+inline void Persons::_internal_set_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.count_ = value;
+}
+inline void Persons::set_count(int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:PROTO.Persons.count)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace PROTO
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_persons_2eproto
@@ -0,0 +1,72 @@
+// Generated by protoc-gen-protodb from persons.proto. DO NOT EDIT.
+
+#ifndef PROTODB_GENERATED_PERSONS_PROTODB_H
+#define PROTODB_GENERATED_PERSONS_PROTODB_H
+
+#include "persons.pb.h"
+#include "proto_db_convertor.hpp"
+
+namespace proto_mapper {
+
+template <> struct ProtoDBCodec<::PROTO::Persons> {
+  static constexpr size_t column_count = 2;
+
+  static void bind_group_id(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::Persons &>(message);
+    sqlite3_bind_text(stmt, index, obj.group_id().data(), (int)obj.group_id().size(), SQLITE_STATIC);
+  }
+
+  static void extract_group_id(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::Persons *>(message);
+      obj->mutable_group_id()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)), sqlite3_column_bytes(stmt, i));
+    }
+  }
+
+  static void bind_count(sqlite3_stmt *stmt, int index,
+      const google::protobuf::Message &message,
+      const google::protobuf::FieldDescriptor *) {
+    const auto &obj = static_cast<const ::PROTO::Persons &>(message);
+    sqlite3_bind_int(stmt, index, obj.count());
+  }
+
+  static void extract_count(sqlite3_stmt *stmt, int i,
+      google::protobuf::Message *message,
+      const google::protobuf::FieldDescriptor *) {
+    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+      auto *obj = static_cast<::PROTO::Persons *>(message);
+      obj->set_count(sqlite3_column_int(stmt, i));
+    }
+  }
+
+  static const ProtoDBCodecColumn *columns() {
+    static const ProtoDBCodecColumn columns[] = {
+        {"group_id", &bind_group_id, &extract_group_id},
+        {"count", &bind_count, &extract_count},
+        {nullptr, nullptr, nullptr}};
+    return columns;
+  }
+
+  // binds every column, in columns() order from index 1
+  static void bind(sqlite3_stmt *stmt, const ::PROTO::Persons &obj) {
+    sqlite3_bind_text(stmt, 1, obj.group_id().data(), (int)obj.group_id().size(), SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, obj.count());
+  }
+
+  // decodes a row selecting every column in columns() order
+  static void decode(sqlite3_stmt *stmt, ::PROTO::Persons *obj) {
+    if (sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+      obj->mutable_group_id()->assign(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)), sqlite3_column_bytes(stmt, 0));
+    }
+    if (sqlite3_column_type(stmt, 1) != SQLITE_NULL) {
+      obj->set_count(sqlite3_column_int(stmt, 1));
+    }
+  }
+};
+
+} // namespace proto_mapper
+#endif // PROTODB_GENERATED_PERSONS_PROTODB_H
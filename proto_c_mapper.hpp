@@ -8,8 +8,13 @@
 #ifndef PROTO2DB_PROTO_C_MAPPER_H
 #define PROTO2DB_PROTO_C_MAPPER_H
 
+#include <algorithm>
+#include <cstring>
 #include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace proto_mapper {
 
@@ -26,6 +31,10 @@ template <typename P, typename C, void P2C(const P &, C &),
           void C2P(const C &, P &)>
 class ProtoCStructMapper<P, C, P2C, C2P> {
 public:
+  using proto_type = P;
+  using struct_type = C;
+  using members = std::tuple<>;
+
   inline static P toP(const C &c) {
     P p;
     convert(c, p);
@@ -40,6 +49,23 @@ public:
 
   inline static void convert(const P &p, C &c) { P2C(p, c); };
   inline static void convert(const C &c, P &p) { C2P(c, p); };
+
+  inline static void convertAll(const std::vector<C> &cs,
+                                RepeatedPtrField<P> *ps) {
+    ps->Clear();
+    ps->Reserve((int)cs.size());
+    for (const auto &c : cs) {
+      convert(c, *ps->Add());
+    }
+  }
+
+  inline static void convertAll(const RepeatedPtrField<P> &ps,
+                                std::vector<C> *cs) {
+    cs->resize(ps.size());
+    for (int i = 0; i < ps.size(); ++i) {
+      convert(ps.Get(i), (*cs)[i]);
+    }
+  }
 };
 
 template <typename P, typename C, void P2C(const P &, C &),
@@ -47,6 +73,10 @@ template <typename P, typename C, void P2C(const P &, C &),
 class ProtoCStructMapper<P, C, P2C, C2P, Field, Fields...>
 /*: public ProtoBufCStructMapping<P, C, P2C, C2P, Fields...>*/ {
 public:
+  using proto_type = P;
+  using struct_type = C;
+  using members = std::tuple<Field, Fields...>;
+
   inline static P toP(const C &c) {
     P p;
     convert(c, p);
@@ -59,23 +89,35 @@ public:
     return c;
   };
 
+  // resolved once per mapped type, nullptr when P has no such field
+  inline static const FieldDescriptor *descriptor() {
+    static const FieldDescriptor *desc =
+        P::descriptor()->FindFieldByName(Field::name);
+    return desc;
+  }
+
   inline static void convert(const P &p, C &c) {
-    auto desc = p.GetDescriptor()->FindFieldByName(Field::name);
+    auto desc = descriptor();
     if (desc != nullptr) {
       if constexpr (std::is_same_v<typename Field::type, int>) {
         int value = p.GetReflection()->GetInt32(p, desc);
         *(int *)((char *)&c + Field::offset) = value;
-      } else if constexpr (std::is_same_v<typename Field::type,
-                                          char *>) { // be careful of memory
-                                                     // overflow
-        string value = p.GetReflection()->GetString(p, desc);
-        memcpy((char *)&c + Field::offset, value.c_str(), value.size());
+      } else if constexpr (std::is_same_v<typename Field::type, char *>) {
+        // truncated to the array, always NUL terminated
+        std::string scratch;
+        const std::string &value =
+            p.GetReflection()->GetStringReference(p, desc, &scratch);
+        char *data = (char *)&c + Field::offset;
+        size_t size = std::min(value.size(), Field::size - 1);
+        memcpy(data, value.data(), size);
+        data[size] = '\0';
       } else if constexpr (std::is_same_v<typename Field::type, bool>) {
         bool value = p.GetReflection()->GetBool(p, desc);
         *(bool *)((char *)&c + Field::offset) = value;
       } else if constexpr (std::is_same_v<typename Field::type, std::string>) {
-        std::string value = p.GetReflection()->GetString(p, desc);
-        *(std::string *)((char *)&c + Field::offset) = value;
+        std::string scratch;
+        *(std::string *)((char *)&c + Field::offset) =
+            p.GetReflection()->GetStringReference(p, desc, &scratch);
       } else if constexpr (std::is_same_v<typename Field::type, double>) {
         double value = p.GetReflection()->GetDouble(p, desc);
         *(double *)((char *)&c + Field::offset) = value;
@@ -108,8 +150,7 @@ public:
   }
 
   inline static void convert(const C &c, P &p) {
-    auto desc = p.GetDescriptor()->FindFieldByName(Field::name);
-    std::string name = desc->name();
+    auto desc = descriptor();
     if (desc != nullptr) {
       if constexpr (std::is_same_v<typename Field::type, int>) {
         int value = *(int *)((char *)&c + Field::offset);
@@ -118,13 +159,15 @@ public:
         bool value = *(bool *)((char *)&c + Field::offset);
         p.GetReflection()->SetBool(&p, desc, value);
       } else if constexpr (std::is_same_v<typename Field::type, char *>) {
-        p.GetReflection()->SetString(&p, desc, ((char *)&c + Field::offset));
+        const char *data = (const char *)&c + Field::offset;
+        p.GetReflection()->SetString(
+            &p, desc, std::string(data, strnlen(data, Field::size)));
       } else if constexpr (std::is_same_v<typename Field::type, double>) {
         double value = *(double *)((char *)&c + Field::offset);
         p.GetReflection()->SetDouble(&p, desc, value);
       } else if constexpr (std::is_same_v<typename Field::type, std::string>) {
-        string value = *(std::string *)((char *)&c + Field::offset);
-        p.GetReflection()->SetString(&p, desc, value);
+        p.GetReflection()->SetString(
+            &p, desc, *(const std::string *)((const char *)&c + Field::offset));
       } else if constexpr (std::is_same_v<
                                typename Field::type,
                                std::vector<typename Field::type::value_type>>) {
@@ -162,6 +205,23 @@ public:
     }
     ProtoCStructMapper<P, C, P2C, C2P, Fields...>::convert(c, p);
   }
+
+  inline static void convertAll(const std::vector<C> &cs,
+                                RepeatedPtrField<P> *ps) {
+    ps->Clear();
+    ps->Reserve((int)cs.size());
+    for (const auto &c : cs) {
+      convert(c, *ps->Add());
+    }
+  }
+
+  inline static void convertAll(const RepeatedPtrField<P> &ps,
+                                std::vector<C> *cs) {
+    cs->resize(ps.size());
+    for (int i = 0; i < ps.size(); ++i) {
+      convert(ps.Get(i), (*cs)[i]);
+    }
+  }
 };
 
 template <char... chars> using tstring = std::integer_sequence<char, chars...>;
@@ -171,18 +231,21 @@ constexpr tstring<chars...> operator""_tstr() {
   return {};
 }
 
-template <typename T, size_t Offset, typename> struct MemberX;
+template <typename T, size_t Offset, typename, size_t Size = sizeof(T)>
+struct MemberX;
 
-template <typename T, size_t Offset, char... elements>
-struct MemberX<T, Offset, tstring<elements...>> {
+template <typename T, size_t Offset, char... elements, size_t Size>
+struct MemberX<T, Offset, tstring<elements...>, Size> {
   static constexpr char name[] = {elements..., '\0'};
   static constexpr size_t offset = Offset;
+  static constexpr size_t size = Size;
   using type = T;
 };
 } // namespace proto_mapper
 
 #define PROTO_MEMBER(P, t, name)                                               \
-  proto_mapper::MemberX<t, offsetof(P, name), decltype(#name##_tstr)>
+  proto_mapper::MemberX<t, offsetof(P, name), decltype(#name##_tstr),          \
+                        sizeof(P::name)>
 
 #define PROTO_MAPER(P, C, P2C, C2P, ...)                                       \
   typedef proto_mapper::ProtoCStructMapper<P, C, P2C, C2P, __VA_ARGS__>        \
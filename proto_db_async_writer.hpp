@@ -0,0 +1,249 @@
+// =================================
+// Created by Lipson on 24-4-1.
+// Email to LipsonChan@yahoo.com
+// Copyright (c) 2024 Lipson. All rights reserved.
+// Version 1.0
+// =================================
+
+#ifndef PROTODB_PROTO_DB_ASYNC_WRITER_HPP
+#define PROTODB_PROTO_DB_ASYNC_WRITER_HPP
+
+#include "proto_db_convertor.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <optional>
+#include <thread>
+
+namespace proto_mapper {
+
+// What a producer gets when the queue is at capacity.
+enum class Backpressure {
+  Block, // wait for the writer thread to make room
+  Drop,  // reject the message, post() returns false
+  Grow   // ignore the capacity
+};
+
+struct AsyncWriterOptions {
+  // queued messages before backpressure applies; 0 is taken as 1
+  size_t capacity = 4096;
+  // a group commit starts once max_batch messages are queued, or window
+  // after the writer thread saw the first one, whichever comes first
+  size_t max_batch = 1000;
+  std::chrono::milliseconds window{5};
+  Backpressure backpressure = Backpressure::Block;
+};
+
+// Write-behind front end for a ProtoDBConvertor. Producers only touch the
+// queue; one background thread writes queued messages through the
+// convertor, committing each group in a single transaction. The convertor
+// must outlive the writer.
+template <typename T, bool BindF(sqlite3_stmt *, int, const std::string &,
+                                 const T &) = DEFAULT_SQLITE_BIND>
+class AsyncProtoDBWriter {
+public:
+  explicit AsyncProtoDBWriter(ProtoDBConvertor<T, BindF> &convertor,
+                              const AsyncWriterOptions &options = {})
+      : convertor_(convertor), options_(options) {
+    if (options_.capacity == 0) {
+      options_.capacity = 1;
+    }
+    if (options_.max_batch == 0) {
+      options_.max_batch = 1;
+    }
+    thread_ = std::thread([this] { run_(); });
+  }
+
+  AsyncProtoDBWriter(const AsyncProtoDBWriter &) = delete;
+  AsyncProtoDBWriter &operator=(const AsyncProtoDBWriter &) = delete;
+
+  // Commits everything still queued before returning.
+  ~AsyncProtoDBWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    not_empty_.notify_one();
+    not_full_.notify_all();
+    thread_.join();
+  }
+
+  // Queues obj without waiting for it to be written. Returns false when
+  // the message was dropped by Backpressure::Drop.
+  bool post(T obj) { return push_(std::move(obj), nullptr); }
+
+  // Queues obj; the future becomes ready once its transaction committed,
+  // and holds the write error if it failed or the message was dropped.
+  std::future<void> write(T obj) {
+    std::promise<void> promise;
+    std::future<void> future = promise.get_future();
+    push_(std::move(obj), &promise);
+    return future;
+  }
+
+  // Waits until every message queued before the call was committed or
+  // failed.
+  void flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t target = queued_;
+    if (finished_ >= target) {
+      return;
+    }
+    flush_requested_ = true;
+    not_empty_.notify_one();
+    done_.wait(lock, [&] { return finished_ >= target; });
+  }
+
+  size_t pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+  }
+
+  uint64_t dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+  }
+
+  uint64_t failed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return failed_;
+  }
+
+private:
+  struct Item {
+    T obj;
+    std::optional<std::promise<void>> promise;
+  };
+
+  bool push_(T &&obj, std::promise<void> *promise) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopping_) {
+      throw std::runtime_error("Async writer is shutting down");
+    }
+    if (queue_.size() >= options_.capacity) {
+      if (options_.backpressure == Backpressure::Drop) {
+        ++dropped_;
+        if (promise != nullptr) {
+          promise->set_exception(std::make_exception_ptr(
+              std::runtime_error("Async writer queue is full")));
+        }
+        return false;
+      }
+      if (options_.backpressure == Backpressure::Block) {
+        not_full_.wait(lock, [this] {
+          return queue_.size() < options_.capacity || stopping_;
+        });
+        // the writer thread may already have drained the queue and quit
+        if (stopping_) {
+          throw std::runtime_error("Async writer is shutting down");
+        }
+      }
+    }
+    Item item{std::move(obj), std::nullopt};
+    if (promise != nullptr) {
+      item.promise = std::move(*promise);
+    }
+    queue_.push_back(std::move(item));
+    ++queued_;
+    if (queue_.size() == 1 || queue_.size() == options_.max_batch) {
+      not_empty_.notify_one();
+    }
+    return true;
+  }
+
+  void run_() {
+    std::vector<Item> batch;
+    batch.reserve(options_.max_batch);
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock,
+                        [this] { return !queue_.empty() || stopping_; });
+        if (queue_.empty()) {
+          return;
+        }
+        // give the group time to fill unless someone is waiting on it
+        auto deadline = std::chrono::steady_clock::now() + options_.window;
+        not_empty_.wait_until(lock, deadline, [this] {
+          return queue_.size() >= options_.max_batch || flush_requested_ ||
+                 stopping_;
+        });
+        size_t count = std::min(queue_.size(), options_.max_batch);
+        for (size_t i = 0; i < count; ++i) {
+          batch.push_back(std::move(queue_.front()));
+          queue_.pop_front();
+        }
+        if (queue_.empty()) {
+          flush_requested_ = false;
+        }
+      }
+      not_full_.notify_all();
+
+      uint64_t failures = commit_(batch);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ += batch.size();
+        failed_ += failures;
+      }
+      done_.notify_all();
+      batch.clear();
+    }
+  }
+
+  // Writes the group in one transaction. If it fails, the rows are retried
+  // one transaction each so only the bad ones report an error.
+  uint64_t commit_(std::vector<Item> &batch) {
+    SafeSQLite &db = *convertor_.db();
+    try {
+      SafeSQLite::Transaction transaction(db);
+      for (auto &item : batch) {
+        convertor_.write(item.obj);
+      }
+      transaction.commit();
+    } catch (const std::exception &) {
+      uint64_t failures = 0;
+      for (auto &item : batch) {
+        try {
+          SafeSQLite::Transaction transaction(db);
+          convertor_.write(item.obj);
+          transaction.commit();
+          if (item.promise) {
+            item.promise->set_value();
+          }
+        } catch (const std::exception &) {
+          ++failures;
+          if (item.promise) {
+            item.promise->set_exception(std::current_exception());
+          }
+        }
+      }
+      return failures;
+    }
+    for (auto &item : batch) {
+      if (item.promise) {
+        item.promise->set_value();
+      }
+    }
+    return 0;
+  }
+
+  ProtoDBConvertor<T, BindF> &convertor_;
+  AsyncWriterOptions options_;
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::condition_variable done_;
+  std::deque<Item> queue_;
+  uint64_t queued_ = 0;
+  uint64_t finished_ = 0;
+  uint64_t dropped_ = 0;
+  uint64_t failed_ = 0;
+  bool flush_requested_ = false;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+} // namespace proto_mapper
+#endif // PROTODB_PROTO_DB_ASYNC_WRITER_HPP
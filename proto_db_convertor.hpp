@@ -8,336 +8,3493 @@
 #ifndef PROTODB_PROTO_DB_CONVERTOR_HPP
 #define PROTODB_PROTO_DB_CONVERTOR_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <functional>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/field_mask.pb.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/message.h>
 #include <iostream>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include "proto_db_metrics.hpp"
 #include <sqlite3.h>
 #include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
+#include <unistd.h>
 #include <vector>
 
 namespace proto_mapper {
 
-class SafeSQLite {
+// Bounded LRU of idle prepared statements keyed by SQL text. A statement is
+// taken out of the cache while in use, so two users never share one.
+class StatementCache {
 public:
-  SafeSQLite(const std::string &filename) {
-    int rc = sqlite3_open(filename.c_str(), &db_);
-    if (rc != SQLITE_OK) {
-      throw std::runtime_error("Failed to open database");
+  explicit StatementCache(sqlite3 *db, size_t capacity = 64,
+                          ConnectionMetrics *metrics = nullptr)
+      : db_(db), capacity_(capacity), metrics_(metrics) {}
+
+  StatementCache(const StatementCache &) = delete;
+  StatementCache &operator=(const StatementCache &) = delete;
+
+  ~StatementCache() { clear(); }
+
+  sqlite3_stmt *acquire(const std::string &sql) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto it = index_.find(sql);
+      if (it != index_.end()) {
+        sqlite3_stmt *stmt = it->second->second;
+        idle_.erase(it->second);
+        index_.erase(it);
+        if (metrics_ != nullptr) {
+          metrics_->statement_cache_hits.add();
+        }
+        return stmt;
+      }
+    }
+    if (metrics_ != nullptr) {
+      metrics_->statement_cache_misses.add();
+    }
+    sqlite3_stmt *stmt = nullptr;
+    if (sqlite3_prepare_v3(db_, sql.c_str(), (int)sql.size() + 1,
+                           SQLITE_PREPARE_PERSISTENT, &stmt,
+                           nullptr) != SQLITE_OK) {
+      throw std::runtime_error("Error querying database: " +
+                               std::string(sqlite3_errmsg(db_)));
+    }
+    return stmt;
+  }
+
+  void release(const std::string &sql, sqlite3_stmt *stmt) {
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (capacity_ == 0 || index_.find(sql) != index_.end()) {
+      sqlite3_finalize(stmt);
+      return;
     }
+    idle_.emplace_front(sql, stmt);
+    index_[sql] = idle_.begin();
+    evict_();
   }
 
-  ~SafeSQLite() { sqlite3_close(db_); }
+  size_t capacity() const { return capacity_; }
 
-  sqlite3 *get() const { return db_; }
-  std::mutex &mutex() { return mutex_; }
+  void set_capacity(size_t capacity) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    evict_();
+  }
 
-  void execute(const std::string &sql = "") {
+  size_t size() {
     std::unique_lock<std::mutex> lock(mutex_);
-    if (!sql.empty()) {
-      sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr);
+    return idle_.size();
+  }
+
+  void clear() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto &entry : idle_) {
+      sqlite3_finalize(entry.second);
     }
+    idle_.clear();
+    index_.clear();
   }
 
 private:
+  void evict_() {
+    while (idle_.size() > capacity_) {
+      sqlite3_finalize(idle_.back().second);
+      index_.erase(idle_.back().first);
+      idle_.pop_back();
+    }
+  }
+
   sqlite3 *db_;
+  size_t capacity_;
+  ConnectionMetrics *metrics_;
   std::mutex mutex_;
+  std::list<std::pair<std::string, sqlite3_stmt *>> idle_;
+  std::unordered_map<std::string,
+                     std::list<std::pair<std::string, sqlite3_stmt *>>::iterator>
+      index_;
 };
 
-template <typename T>
-bool DEFAULT_SQLITE_BIND(sqlite3_stmt *, int, const std::string &, const T &) {
-  return false;
-}
+// A statement checked out of a StatementCache, handed back on destruction.
+class CachedStatement {
+public:
+  CachedStatement(StatementCache &cache, const std::string &sql)
+      : cache_(&cache), sql_(sql), stmt_(cache.acquire(sql)) {}
 
-// template <typename T, std::function<bool(sqlite3_stmt *, int, const std::string &, const T &)> ConvF = DEFAULT_CONVERT> template <typename T, typename ConvF>
-template <typename T, bool BindF(sqlite3_stmt *, int, const std::string &,
-                                 const T &) = DEFAULT_SQLITE_BIND>
-class ProtoDBConvertor {
+  CachedStatement(CachedStatement &&other) noexcept
+      : cache_(other.cache_), sql_(std::move(other.sql_)),
+        stmt_(other.stmt_) {
+    other.stmt_ = nullptr;
+  }
+
+  CachedStatement(const CachedStatement &) = delete;
+  CachedStatement &operator=(const CachedStatement &) = delete;
+  CachedStatement &operator=(CachedStatement &&) = delete;
+
+  ~CachedStatement() {
+    if (stmt_ != nullptr) {
+      cache_->release(sql_, stmt_);
+    }
+  }
+
+  sqlite3_stmt *get() const { return stmt_; }
+
+private:
+  StatementCache *cache_;
+  std::string sql_;
+  sqlite3_stmt *stmt_;
+};
+
+struct RowCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+  size_t entries = 0;
+  size_t bytes = 0;
+
+  double hit_rate() const {
+    return hits + misses == 0 ? 0 : (double)hits / (hits + misses);
+  }
+};
+
+// LRU of decoded rows keyed by primary key text, bounded by the memory the
+// messages use (SpaceUsedLong) rather than by entry count. It has a mutex
+// of its own, so hits never wait on the connection lock.
+//
+// Every put or erase advances version(). A reader that decoded a row from
+// the database passes the version it saw before the query to fill(), which
+// drops the row if a write happened in between.
+template <typename T> class RowCache {
 public:
-  explicit ProtoDBConvertor(
-      const std::shared_ptr<SafeSQLite> &db,
-      const std::string &primary_key = "",
-      const std::unordered_set<std::string> &skip_names = {},
-      bool need_create_table = false)
-      : db_(db), primary_key_(primary_key) {
-    std::unique_lock<std::mutex> lock(db_->mutex());
+  explicit RowCache(size_t capacity_bytes) : capacity_(capacity_bytes) {}
 
-    const google::protobuf::Descriptor *descriptor = T::descriptor();
-    table_name_ = descriptor->name();
+  RowCache(const RowCache &) = delete;
+  RowCache &operator=(const RowCache &) = delete;
 
-    for (int i = 0; i < descriptor->field_count(); ++i) {
-      const auto &field = *descriptor->field(i);
-      std::string field_name = field.name();
-      if (skip_names.find(field_name) != skip_names.end()) {
-        continue;
-      }
-      member_names_.push_back(field_name);
+  // Bookkeeping charged per entry on top of the key and message.
+  static constexpr size_t entry_overhead = 96;
+
+  std::shared_ptr<const T> find(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      ++misses_;
+      return nullptr;
     }
+    ++hits_;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->value;
+  }
 
-    if (need_create_table) {
-      create_table_();
+  uint64_t version() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return version_;
+  }
+
+  void fill(const std::string &key, std::shared_ptr<const T> value,
+            uint64_t version) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (version == version_) {
+      insert_(key, std::move(value));
     }
+  }
 
-    std::string insert_sql;
-    if (primary_key_.empty()) {
-      insert_sql = "INSERT INTO " + table_name_ + " (";
-    } else {
-      insert_sql = "REPLACE INTO " + table_name_ + " (";
+  void put(const std::string &key, std::shared_ptr<const T> value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    insert_(key, std::move(value));
+  }
+
+  void erase(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      remove_(it->second);
     }
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  RowCacheStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return RowCacheStats{hits_, misses_, evictions_, lru_.size(), bytes_};
+  }
+
+private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const T> value;
+    size_t bytes;
+  };
 
-    for (const auto &field_name : member_names_) {
-      insert_sql += field_name + ",";
+  void insert_(const std::string &key, std::shared_ptr<const T> value) {
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      remove_(it->second);
     }
-    insert_sql.pop_back();
-    insert_sql += ") VALUES (";
-    for (size_t i = 0; i < member_names_.size(); ++i) {
-      insert_sql += "?,";
+    size_t bytes = key.size() + value->SpaceUsedLong() + entry_overhead;
+    if (bytes > capacity_) {
+      return;
     }
-    insert_sql.pop_back();
-    insert_sql += ");";
-
-    if (!primary_key_.empty()) {
-      auto sql = "DELETE FROM " + T::descriptor()->name() + " WHERE " +
-                 primary_key_ + " = ?";
-      if (sqlite3_prepare_v2(db_->get(), sql.c_str(), -1, &delete_stmt_,
-                             nullptr) != SQLITE_OK) {
-        throw std::runtime_error("Failed to prepare statement");
-      }
+    lru_.push_front(Entry{key, std::move(value), bytes});
+    index_[key] = lru_.begin();
+    bytes_ += bytes;
+    while (bytes_ > capacity_) {
+      remove_(std::prev(lru_.end()));
+      ++evictions_;
     }
+  }
 
-    if (sqlite3_prepare_v2(db_->get(), insert_sql.c_str(), -1, &insert_stmt_,
-                           nullptr) != SQLITE_OK) {
-      throw std::runtime_error("Failed to prepare statement");
-    }
+  void remove_(typename std::list<Entry>::iterator entry) {
+    bytes_ -= entry->bytes;
+    index_.erase(entry->key);
+    lru_.erase(entry);
   }
 
-  ~ProtoDBConvertor() {
-    sqlite3_finalize(insert_stmt_);
-    sqlite3_finalize(delete_stmt_);
+  size_t capacity_;
+  mutable std::mutex mutex_;
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, typename std::list<Entry>::iterator> index_;
+  size_t bytes_ = 0;
+  uint64_t version_ = 0;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  uint64_t evictions_ = 0;
+};
+
+// Arguments that bind themselves, e.g. a lookup value bound by the binder
+// of the column it is compared with.
+template <typename V, typename = void>
+struct self_binding : std::false_type {};
+
+template <typename V>
+struct self_binding<V, std::void_t<decltype(std::declval<const V &>().bind(
+                           std::declval<sqlite3_stmt *>(), 0))>>
+    : std::true_type {};
+
+template <typename V>
+void bind_value(sqlite3_stmt *stmt, int index, const V &value) {
+  int rc;
+  if constexpr (std::is_same_v<V, std::nullptr_t>) {
+    rc = sqlite3_bind_null(stmt, index);
+  } else if constexpr (self_binding<V>::value) {
+    value.bind(stmt, index);
+    return;
+  } else if constexpr (std::is_integral_v<V> || std::is_enum_v<V>) {
+    rc = sqlite3_bind_int64(stmt, index, (sqlite3_int64)value);
+  } else if constexpr (std::is_floating_point_v<V>) {
+    rc = sqlite3_bind_double(stmt, index, (double)value);
+  } else if constexpr (std::is_convertible_v<const V &, std::string_view>) {
+    std::string_view text = value;
+    rc = sqlite3_bind_text(stmt, index, text.data(), (int)text.size(),
+                           SQLITE_TRANSIENT);
+  } else {
+    static_assert(!sizeof(V), "Unsupported bind argument type");
   }
+  if (rc != SQLITE_OK) {
+    throw std::runtime_error("Failed to bind parameter " +
+                             std::to_string(index) + ": " +
+                             sqlite3_errstr(rc));
+  }
+}
 
-  bool create_table() {
-    std::unique_lock<std::mutex> lock(db_->mutex());
-    return create_table_();
+template <typename... Args>
+void bind_values(sqlite3_stmt *stmt, const Args &...args) {
+  if constexpr (sizeof...(Args) != 0) {
+    int index = 1;
+    (bind_value(stmt, index++, args), ...);
   }
+}
 
-  bool create_table_() {
-    std::string create_sql = "CREATE TABLE IF NOT EXISTS " + table_name_ + " (";
-    for (const auto &memberName : member_names_) {
-      const auto &field = *T::descriptor()->FindFieldByName(memberName);
-      std::string field_name = field.name();
-      std::string field_type;
-      switch (field.type()) {
-      case google::protobuf::FieldDescriptor::TYPE_INT32:
-      case google::protobuf::FieldDescriptor::TYPE_INT64:
-      case google::protobuf::FieldDescriptor::TYPE_UINT32:
-      case google::protobuf::FieldDescriptor::TYPE_UINT64:
-      case google::protobuf::FieldDescriptor::TYPE_SINT32:
-      case google::protobuf::FieldDescriptor::TYPE_SINT64:
-      case google::protobuf::FieldDescriptor::TYPE_FIXED32:
-      case google::protobuf::FieldDescriptor::TYPE_FIXED64:
-      case google::protobuf::FieldDescriptor::TYPE_SFIXED32:
-      case google::protobuf::FieldDescriptor::TYPE_SFIXED64:
-      case google::protobuf::FieldDescriptor::TYPE_ENUM:
-        field_type = "INTEGER";
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_FLOAT:
-      case google::protobuf::FieldDescriptor::TYPE_DOUBLE:
-        field_type = "REAL";
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_BOOL:
-        field_type = "BOOLEAN";
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_STRING:
-        field_type = "TEXT";
-        break;
-      default:
-        field_type = "BLOB";
-        break;
-      }
-      if (primary_key_ == field_name) {
-        create_sql += field_name + " " + field_type +
-                      " PRIMARY KEY NOT NULL ON CONFLICT REPLACE,";
-      } else {
-        create_sql += field_name + " " + field_type + ",";
+// How a committed row change was made. sqlite reports REPLACE INTO as an
+// Insert: the row it displaces is removed without an event of its own.
+// ProtoDBConvertor therefore writes with an upsert while anybody listens,
+// which keeps the rowid and reports an Update.
+enum class ChangeOp { Insert, Update, Delete };
+
+struct Change {
+  ChangeOp op;
+  std::string table;
+  sqlite3_int64 rowid;
+  // the primary key as text (see key_text) when the row was changed under
+  // a SafeSQLite::ChangeKey, otherwise empty
+  std::string key;
+};
+
+// Called with the changes of one committed transaction, in commit order.
+using ChangeListener = std::function<void(const std::vector<Change> &)>;
+
+class SafeSQLite {
+  struct Connection;
+
+public:
+  // With reader_count > 0 the database is switched to WAL and reads run on
+  // their own pool of read-only connections, so they no longer wait on the
+  // writer or on each other. Pooled readers only see committed data.
+  SafeSQLite(const std::string &filename, size_t reader_count = 0)
+      : filename_(filename) {
+    int rc = sqlite3_open(filename.c_str(), &db_);
+    if (rc != SQLITE_OK) {
+      sqlite3_close(db_);
+      throw std::runtime_error("Failed to open database");
+    }
+    // without a pool the file can still be shared with other connections
+    sqlite3_busy_timeout(db_, busy_timeout_ms);
+    statements_ = std::make_unique<StatementCache>(db_, 64, &metrics_);
+    if (reader_count == 0) {
+      return;
+    }
+    if (filename.empty() || filename == ":memory:") {
+      close_();
+      throw std::runtime_error("Reader pool needs a database file");
+    }
+    try {
+      exec_or_throw_("PRAGMA journal_mode=WAL");
+      for (size_t i = 0; i < reader_count; ++i) {
+        readers_.push_back(std::make_unique<Connection>(filename, &metrics_));
+        idle_readers_.push_back(readers_.back().get());
       }
+    } catch (...) {
+      close_();
+      throw;
     }
-    create_sql.pop_back();
-    create_sql += ");";
+  }
 
-    char *errmsg;
-    if (sqlite3_exec(db_->get(), create_sql.c_str(), nullptr, nullptr,
-                     &errmsg) != SQLITE_OK) {
-      std::cerr << "Failed to create table: " << errmsg;
-      return false;
+  SafeSQLite(const SafeSQLite &) = delete;
+  SafeSQLite &operator=(const SafeSQLite &) = delete;
+
+  ~SafeSQLite() { close_(); }
+
+  static constexpr int busy_timeout_ms = 5000;
+  // sqlite's default, kept while the change feed owns the WAL hook
+  static constexpr int wal_autocheckpoint_pages = 1000;
+
+  sqlite3 *get() const { return db_; }
+  std::recursive_mutex &mutex() { return mutex_; }
+  StatementCache &statements() { return *statements_; }
+
+  // Takes the connection lock, recording the wait in metrics().
+  std::unique_lock<std::recursive_mutex> lock() {
+    ScopedLatency timer(metrics_.lock_wait);
+    return std::unique_lock<std::recursive_mutex>(mutex_);
+  }
+
+  ConnectionMetricsSnapshot metrics() const { return metrics_.snapshot(); }
+  const std::string &filename() const { return filename_; }
+  size_t reader_count() const { return readers_.size(); }
+
+  // A read-only connection checked out of the pool, or the writer connection
+  // when there is no pool. Returned to the pool on destruction.
+  class Reader {
+  public:
+    Reader(SafeSQLite *owner, sqlite3 *db, StatementCache *statements,
+           Connection *slot)
+        : owner_(owner), db_(db), statements_(statements), slot_(slot) {}
+
+    // Owns a connection of its own, closed with the Reader.
+    explicit Reader(std::unique_ptr<Connection> owned)
+        : owner_(nullptr), db_(owned->db),
+          statements_(owned->statements.get()), slot_(nullptr),
+          owned_(std::move(owned)) {}
+
+    Reader(Reader &&other) noexcept
+        : owner_(other.owner_), db_(other.db_),
+          statements_(other.statements_), slot_(other.slot_),
+          owned_(std::move(other.owned_)) {
+      other.slot_ = nullptr;
     }
 
-    return true;
+    Reader(const Reader &) = delete;
+    Reader &operator=(const Reader &) = delete;
+    Reader &operator=(Reader &&) = delete;
+
+    ~Reader() {
+      if (slot_ != nullptr) {
+        owner_->release_reader_(slot_);
+      }
+    }
+
+    sqlite3 *get() const { return db_; }
+    StatementCache &statements() const { return *statements_; }
+
+  private:
+    SafeSQLite *owner_;
+    sqlite3 *db_;
+    StatementCache *statements_;
+    Connection *slot_;
+    std::unique_ptr<Connection> owned_;
+  };
+
+  // Blocks until a pooled connection is free. A thread must not hold more
+  // than reader_count() readers at once.
+  Reader reader() {
+    if (readers_.empty()) {
+      return Reader(this, db_, statements_.get(), nullptr);
+    }
+    ScopedLatency timer(metrics_.reader_wait);
+    std::unique_lock<std::mutex> lock(readers_mutex_);
+    readers_cv_.wait(lock, [this] { return !idle_readers_.empty(); });
+    Connection *connection = idle_readers_.back();
+    idle_readers_.pop_back();
+    return Reader(this, connection->db, connection->statements.get(),
+                  connection);
   }
 
-  void write(const T &obj) {
-    std::unique_lock<std::mutex> lock(db_->mutex());
-    write_(obj);
+  // Opens a read-only connection outside the pool for the Reader's lifetime,
+  // for work that needs more connections than the pool holds. It sees only
+  // committed data.
+  Reader open_reader() {
+    if (filename_.empty() || filename_ == ":memory:") {
+      throw std::runtime_error("Extra readers need a database file");
+    }
+    return Reader(std::make_unique<Connection>(filename_, &metrics_));
   }
 
-  void write(const std::vector<T> &obj) {
-    std::unique_lock<std::mutex> lock(db_->mutex());
-    for (auto &o : obj) {
-      write_(o);
-    }
-  }
-
-  void convert_filed_(sqlite3_stmt *stmt, int index, const std::string &name,
-                      const T &obj) {
-    if (!BindF(stmt, index, name, obj)) {
-      const auto &field = *T::descriptor()->FindFieldByName(name);
-      switch (field.type()) {
-      case google::protobuf::FieldDescriptor::TYPE_INT32:
-        sqlite3_bind_int(stmt, index,
-                         obj.GetReflection()->GetInt32(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_INT64:
-        sqlite3_bind_int64(stmt, index,
-                           obj.GetReflection()->GetInt64(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_UINT32:
-        sqlite3_bind_int(stmt, index,
-                         obj.GetReflection()->GetUInt32(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_UINT64:
-        sqlite3_bind_int64(stmt, index,
-                           obj.GetReflection()->GetUInt64(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_FIXED32:
-        sqlite3_bind_int(stmt, index,
-                         obj.GetReflection()->GetUInt32(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_FIXED64:
-        sqlite3_bind_int64(stmt, index,
-                           obj.GetReflection()->GetUInt64(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_SFIXED32:
-        sqlite3_bind_int(stmt, index,
-                         obj.GetReflection()->GetInt32(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_SFIXED64:
-        sqlite3_bind_int64(stmt, index,
-                           obj.GetReflection()->GetInt64(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_FLOAT:
-        sqlite3_bind_double(stmt, index,
-                            obj.GetReflection()->GetFloat(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_DOUBLE:
-        sqlite3_bind_double(stmt, index,
-                            obj.GetReflection()->GetDouble(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_BOOL:
-        sqlite3_bind_int(stmt, index,
-                         obj.GetReflection()->GetBool(obj, &field));
-        break;
-      case google::protobuf::FieldDescriptor::TYPE_STRING:
-        sqlite3_bind_text(stmt, index,
-                          obj.GetReflection()->GetString(obj, &field).c_str(),
-                          -1, SQLITE_TRANSIENT);
-        break;
-      default: // handle bytes
-        throw std::runtime_error("Unsupported field type: " + field.name());
+  // Delivers the row changes of every transaction committed on the writer
+  // connection to listener, from a delivery thread of its own so writers
+  // never wait on it. Rolled back changes, including those of rolled back
+  // savepoints, are never delivered. Changes made through other connections,
+  // rows deleted by the truncate optimization and rows REPLACE INTO deletes
+  // are not seen. The hooks are only installed while somebody listens.
+  uint64_t subscribe(ChangeListener listener) {
+    auto lock = this->lock();
+    uint64_t id;
+    {
+      std::lock_guard<std::mutex> changes_lock(changes_mutex_);
+      id = ++last_listener_id_;
+      listeners_.emplace_back(
+          id, std::make_shared<ChangeListener>(std::move(listener)));
+      if (!dispatcher_.joinable()) {
+        dispatcher_ = std::thread([this] { dispatch_changes_(); });
       }
     }
+    if (!hooks_installed_) {
+      wal_ = journal_mode_() == "wal";
+      sqlite3_update_hook(db_, &SafeSQLite::on_update_, this);
+      sqlite3_commit_hook(db_, &SafeSQLite::on_commit_, this);
+      sqlite3_rollback_hook(db_, &SafeSQLite::on_rollback_, this);
+      if (wal_) {
+        sqlite3_wal_hook(db_, &SafeSQLite::on_wal_commit_, this);
+      } else {
+        sqlite3_trace_v2(db_, SQLITE_TRACE_PROFILE,
+                         &SafeSQLite::on_statement_done_, this);
+      }
+      hooks_installed_ = true;
+    }
+    return id;
   }
 
-  void write_(const T &obj) {
-    int index = 1;
-    for (const auto &name : member_names_) {
-      convert_filed_(insert_stmt_, index, name, obj);
-      ++index;
+  // Once it returns the listener is no longer running and is not called
+  // again, unless it is the listener that unsubscribes itself. It waits for
+  // a running delivery, so it must not be called while holding lock() or an
+  // open Transaction if a listener uses the database: the listener would
+  // wait for the lock and this for the listener.
+  void unsubscribe(uint64_t id) {
+    bool last;
+    {
+      std::unique_lock<std::mutex> changes_lock(changes_mutex_);
+      listeners_.erase(std::remove_if(listeners_.begin(), listeners_.end(),
+                                      [id](const auto &listener) {
+                                        return listener.first == id;
+                                      }),
+                       listeners_.end());
+      if (std::this_thread::get_id() != dispatcher_.get_id()) {
+        delivered_.wait(changes_lock, [this] { return !delivering_; });
+      }
+      last = listeners_.empty();
+    }
+    if (!last) {
+      return;
+    }
+    auto lock = this->lock();
+    std::lock_guard<std::mutex> changes_lock(changes_mutex_);
+    if (listeners_.empty() && hooks_installed_) {
+      sqlite3_update_hook(db_, nullptr, nullptr);
+      sqlite3_commit_hook(db_, nullptr, nullptr);
+      sqlite3_rollback_hook(db_, nullptr, nullptr);
+      if (wal_) {
+        sqlite3_wal_autocheckpoint(db_, wal_autocheckpoint_pages);
+      } else {
+        sqlite3_trace_v2(db_, 0, nullptr, nullptr);
+      }
+      pending_changes_.clear();
+      committing_changes_.clear();
+      hooks_installed_ = false;
     }
-    sqlite3_step(insert_stmt_);
-    sqlite3_reset(insert_stmt_);
   }
 
-  std::vector<T>
-  read(const std::string &sql = "select * from " +
-                                std::string(T::descriptor()->name())) {
-    const google::protobuf::Descriptor *descriptor = T::descriptor();
+  // Waits until the changes committed before the call were delivered. Like
+  // unsubscribe(), not while holding lock() or an open Transaction.
+  void flush_changes() {
+    std::unique_lock<std::mutex> changes_lock(changes_mutex_);
+    if (std::this_thread::get_id() == dispatcher_.get_id()) {
+      return;
+    }
+    uint64_t target = committed_batches_;
+    delivered_.wait(changes_lock,
+                    [&] { return delivered_batches_ >= target; });
+  }
 
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db_->get(), sql.c_str(), -1, &stmt, nullptr) !=
-        SQLITE_OK) {
-      throw std::runtime_error("Error querying database: " +
-                               std::string(sqlite3_errmsg(db_->get())));
+  void execute(const std::string &sql = "") {
+    auto lock = this->lock();
+    if (!sql.empty()) {
+      sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr);
     }
+  }
 
-    std::vector<T> result;
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-      T obj;
-      const google::protobuf::Reflection *reflection = obj.GetReflection();
-      for (int i = 0; i < sqlite3_column_count(stmt); ++i) {
-        const char *name = sqlite3_column_name(stmt, i);
-        const google::protobuf::FieldDescriptor *field =
-            descriptor->FindFieldByName(name);
-        if (field == nullptr) {
-          throw std::runtime_error("Unknown field name: " + std::string(name));
+  // Holds the connection lock and an open transaction until commit() or
+  // destruction. Nested scopes become savepoints, so an inner rollback only
+  // undoes its own writes. Anything not committed is rolled back.
+  class Transaction {
+  public:
+    explicit Transaction(SafeSQLite &db) : db_(db), lock_(db.lock()) {
+      if (sqlite3_get_autocommit(db_.db_)) {
+        db_.exec_or_throw_("BEGIN");
+      } else {
+        savepoint_ = "protodb_sp_" + std::to_string(db_.savepoint_depth_);
+        db_.exec_or_throw_("SAVEPOINT " + savepoint_);
+        ++db_.savepoint_depth_;
+        change_mark_ = db_.pending_changes_.size();
+      }
+    }
+
+    Transaction(const Transaction &) = delete;
+    Transaction &operator=(const Transaction &) = delete;
+
+    ~Transaction() {
+      if (!finished_) {
+        try {
+          rollback();
+        } catch (const std::exception &e) {
+          std::cerr << "Failed to rollback: " << e.what() << std::endl;
         }
-        switch (field->cpp_type()) {
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_INT32:
-          reflection->SetInt32(&obj, field, sqlite3_column_int(stmt, i));
-          break;
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_INT64:
-          reflection->SetInt64(&obj, field, sqlite3_column_int64(stmt, i));
-          break;
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_UINT32:
-          reflection->SetUInt32(&obj, field, sqlite3_column_int(stmt, i));
-          break;
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_UINT64:
-          reflection->SetUInt64(&obj, field, sqlite3_column_int64(stmt, i));
-          break;
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_FLOAT:
-          reflection->SetFloat(&obj, field, sqlite3_column_double(stmt, i));
-          break;
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_DOUBLE:
-          reflection->SetDouble(&obj, field, sqlite3_column_double(stmt, i));
-          break;
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_BOOL:
-          reflection->SetBool(&obj, field, sqlite3_column_int(stmt, i) != 0);
-          break;
-        case google::protobuf::FieldDescriptor::CppType::CPPTYPE_STRING:
-          reflection->SetString(
-              &obj, field,
-              reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)));
-          break;
-        default:
-          throw std::runtime_error("Unsupported field type: " + field->name());
+      }
+    }
+
+    void commit() {
+      if (finished_) {
+        return;
+      }
+      if (savepoint_.empty()) {
+        db_.exec_or_throw_("COMMIT");
+      } else {
+        db_.exec_or_throw_("RELEASE " + savepoint_);
+        --db_.savepoint_depth_;
+      }
+      finished_ = true;
+    }
+
+    void rollback() {
+      if (finished_) {
+        return;
+      }
+      finished_ = true;
+      if (savepoint_.empty()) {
+        if (!sqlite3_get_autocommit(db_.db_)) {
+          db_.exec_or_throw_("ROLLBACK");
+        }
+      } else {
+        --db_.savepoint_depth_;
+        db_.exec_or_throw_("ROLLBACK TO " + savepoint_ + "; RELEASE " +
+                           savepoint_);
+        // ROLLBACK TO does not fire the rollback hook
+        if (db_.pending_changes_.size() > change_mark_) {
+          db_.pending_changes_.resize(change_mark_);
         }
       }
-      result.push_back(obj);
     }
 
+  private:
+    SafeSQLite &db_;
+    std::unique_lock<std::recursive_mutex> lock_;
+    std::string savepoint_;
+    size_t change_mark_ = 0;
+    bool finished_ = false;
+  };
+
+  Transaction transaction() { return Transaction(*this); }
+
+  // Whether the change feed records changes; the connection lock must be
+  // held.
+  bool recording_changes() const { return hooks_installed_; }
+
+  // While it lives, changes to table are recorded with key. For statements
+  // that change the rows of one primary key only; the connection lock must
+  // be held.
+  class ChangeKey {
+  public:
+    ChangeKey(SafeSQLite &db, const std::string &table, std::string key)
+        : db_(db) {
+      db_.change_table_ = &table;
+      db_.change_key_ = std::move(key);
+    }
+
+    ChangeKey(const ChangeKey &) = delete;
+    ChangeKey &operator=(const ChangeKey &) = delete;
+
+    ~ChangeKey() {
+      db_.change_table_ = nullptr;
+      db_.change_key_.clear();
+    }
+
+  private:
+    SafeSQLite &db_;
+  };
+
+private:
+  void exec_or_throw_(const std::string &sql) {
+    char *errmsg = nullptr;
+    if (sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, &errmsg) !=
+        SQLITE_OK) {
+      std::string error = errmsg ? errmsg : sqlite3_errmsg(db_);
+      sqlite3_free(errmsg);
+      throw std::runtime_error("Failed to execute " + sql + ": " + error);
+    }
+  }
+
+  struct Connection {
+    Connection(const std::string &filename, ConnectionMetrics *metrics) {
+      if (sqlite3_open_v2(filename.c_str(), &db,
+                          SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
+                          nullptr) != SQLITE_OK) {
+        sqlite3_close(db);
+        throw std::runtime_error("Failed to open reader for " + filename);
+      }
+      sqlite3_busy_timeout(db, busy_timeout_ms);
+      statements = std::make_unique<StatementCache>(db, 64, metrics);
+    }
+
+    ~Connection() {
+      statements.reset();
+      sqlite3_close(db);
+    }
+
+    sqlite3 *db = nullptr;
+    std::unique_ptr<StatementCache> statements;
+  };
+
+  std::string journal_mode_() {
+    sqlite3_stmt *stmt = nullptr;
+    std::string mode;
+    if (sqlite3_prepare_v2(db_, "PRAGMA journal_mode", -1, &stmt, nullptr) ==
+            SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+      mode = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+    }
     sqlite3_finalize(stmt);
+    return mode;
+  }
 
-    return result;
+  // The hooks run inside sqlite3_step on the writer connection, so
+  // pending_changes_ is guarded by mutex_ like every other writer access.
+  static void on_update_(void *self, int op, const char *,
+                         const char *table, sqlite3_int64 rowid) {
+    ChangeOp change_op = op == SQLITE_INSERT   ? ChangeOp::Insert
+                         : op == SQLITE_UPDATE ? ChangeOp::Update
+                                               : ChangeOp::Delete;
+    auto *db = static_cast<SafeSQLite *>(self);
+    bool keyed = db->change_table_ != nullptr && *db->change_table_ == table;
+    db->pending_changes_.push_back(Change{
+        change_op, table, rowid, keyed ? db->change_key_ : std::string()});
   }
 
-  void delete_obj(const T &obj) {
-    if (primary_key_.empty()) {
+  // The commit hook runs before the commit is done, when other connections
+  // cannot see it yet and it can still fail. In WAL mode the batch is
+  // therefore published from the WAL hook, which runs once the commit is in
+  // the log. Otherwise it is set aside until the statement that committed
+  // has finished and the connection is back in autocommit; a failed commit
+  // either rolls back, which drops it, or leaves the transaction open.
+  static int on_commit_(void *self) {
+    auto *db = static_cast<SafeSQLite *>(self);
+    if (!db->wal_) {
+      db->committing_changes_.insert(db->committing_changes_.end(),
+                                     db->pending_changes_.begin(),
+                                     db->pending_changes_.end());
+      db->pending_changes_.clear();
+    }
+    return 0;
+  }
+
+  static int on_statement_done_(unsigned, void *self, void *, void *) {
+    auto *db = static_cast<SafeSQLite *>(self);
+    if (!db->committing_changes_.empty() && sqlite3_get_autocommit(db->db_)) {
+      db->publish_changes_(db->committing_changes_);
+    }
+    return 0;
+  }
+
+  // Replaces sqlite's own auto-checkpoint hook, so it checkpoints the same
+  // way.
+  static int on_wal_commit_(void *self, sqlite3 *handle, const char *name,
+                            int pages) {
+    auto *db = static_cast<SafeSQLite *>(self);
+    db->publish_changes_(db->pending_changes_);
+    if (pages >= wal_autocheckpoint_pages) {
+      sqlite3_wal_checkpoint(handle, name);
+    }
+    return SQLITE_OK;
+  }
+
+  void publish_changes_(std::vector<Change> &changes) {
+    if (changes.empty()) {
       return;
     }
+    {
+      std::lock_guard<std::mutex> changes_lock(changes_mutex_);
+      committed_changes_.push_back(std::move(changes));
+      ++committed_batches_;
+    }
+    changes.clear();
+    changes_cv_.notify_one();
+  }
+
+  static void on_rollback_(void *self) {
+    auto *db = static_cast<SafeSQLite *>(self);
+    db->pending_changes_.clear();
+    db->committing_changes_.clear();
+  }
+
+  void dispatch_changes_() {
+    std::unique_lock<std::mutex> changes_lock(changes_mutex_);
+    for (;;) {
+      changes_cv_.wait(changes_lock, [this] {
+        return !committed_changes_.empty() || stopping_;
+      });
+      if (committed_changes_.empty()) {
+        return;
+      }
+      std::vector<Change> batch = std::move(committed_changes_.front());
+      committed_changes_.pop_front();
+      auto listeners = listeners_;
+      delivering_ = true;
+      changes_lock.unlock();
+      for (const auto &listener : listeners) {
+        try {
+          (*listener.second)(batch);
+        } catch (const std::exception &e) {
+          std::cerr << "Change listener failed: " << e.what() << std::endl;
+        }
+      }
+      changes_lock.lock();
+      delivering_ = false;
+      ++delivered_batches_;
+      delivered_.notify_all();
+    }
+  }
+
+  void release_reader_(Connection *connection) {
+    // a lease may leave a snapshot transaction open, end it before reuse
+    if (!sqlite3_get_autocommit(connection->db)) {
+      sqlite3_exec(connection->db, "ROLLBACK", nullptr, nullptr, nullptr);
+    }
+    {
+      std::unique_lock<std::mutex> lock(readers_mutex_);
+      idle_readers_.push_back(connection);
+    }
+    readers_cv_.notify_one();
+  }
 
-    convert_filed_(delete_stmt_, 1, primary_key_, obj);
-    sqlite3_step(delete_stmt_);
-    sqlite3_reset(delete_stmt_);
+  void close_() {
+    if (dispatcher_.joinable()) {
+      {
+        std::lock_guard<std::mutex> changes_lock(changes_mutex_);
+        stopping_ = true;
+      }
+      changes_cv_.notify_one();
+      dispatcher_.join();
+    }
+    readers_.clear();
+    statements_.reset();
+    sqlite3_close(db_);
+    db_ = nullptr;
+  }
+
+  std::string filename_;
+  sqlite3 *db_ = nullptr;
+  std::recursive_mutex mutex_;
+  ConnectionMetrics metrics_;
+  std::unique_ptr<StatementCache> statements_;
+  int savepoint_depth_ = 0;
+  std::vector<std::unique_ptr<Connection>> readers_;
+  std::vector<Connection *> idle_readers_;
+  std::mutex readers_mutex_;
+  std::condition_variable readers_cv_;
+  // change feed
+  bool hooks_installed_ = false;
+  bool wal_ = false;
+  std::vector<Change> pending_changes_;
+  // committed by the commit hook, not yet done (rollback journal only)
+  std::vector<Change> committing_changes_;
+  // set by ChangeKey
+  const std::string *change_table_ = nullptr;
+  std::string change_key_;
+  std::mutex changes_mutex_;
+  std::condition_variable changes_cv_;
+  std::condition_variable delivered_;
+  std::deque<std::vector<Change>> committed_changes_;
+  std::vector<std::pair<uint64_t, std::shared_ptr<ChangeListener>>>
+      listeners_;
+  uint64_t last_listener_id_ = 0;
+  uint64_t committed_batches_ = 0;
+  uint64_t delivered_batches_ = 0;
+  bool delivering_ = false;
+  bool stopping_ = false;
+  std::thread dispatcher_;
+};
+
+// Unsubscribes from a SafeSQLite change feed on destruction, so the same
+// rule as for SafeSQLite::unsubscribe() applies to where it is destroyed.
+class ChangeSubscription {
+public:
+  ChangeSubscription() = default;
+  ChangeSubscription(std::shared_ptr<SafeSQLite> db, uint64_t id)
+      : db_(std::move(db)), id_(id) {}
+
+  ChangeSubscription(ChangeSubscription &&other) noexcept
+      : db_(std::move(other.db_)), id_(other.id_) {}
+
+  ChangeSubscription &operator=(ChangeSubscription &&other) noexcept {
+    if (this != &other) {
+      reset();
+      db_ = std::move(other.db_);
+      id_ = other.id_;
+    }
+    return *this;
+  }
+
+  ChangeSubscription(const ChangeSubscription &) = delete;
+  ChangeSubscription &operator=(const ChangeSubscription &) = delete;
+
+  ~ChangeSubscription() { reset(); }
+
+  void reset() {
+    if (db_) {
+      db_->unsubscribe(id_);
+      db_.reset();
+    }
+  }
+
+private:
+  std::shared_ptr<SafeSQLite> db_;
+  uint64_t id_ = 0;
+};
+
+// Strings and bytes are bound by reference (SQLITE_STATIC), so the message
+// must stay alive and unchanged until the statement has been stepped.
+using FieldBinder = void (*)(sqlite3_stmt *, int,
+                             const google::protobuf::Message &,
+                             const google::protobuf::FieldDescriptor *);
+using FieldExtractor = void (*)(sqlite3_stmt *, int,
+                                google::protobuf::Message *,
+                                const google::protobuf::FieldDescriptor *);
+
+// Packed columns: repeated scalars are stored as their fixed-width
+// little-endian values back to back, repeated strings as a 32-bit
+// little-endian length followed by the bytes of each element.
+inline constexpr bool host_little_endian() {
+  return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+}
+
+template <typename V> void swap_packed_bytes(V *values, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    auto *bytes = reinterpret_cast<unsigned char *>(&values[i]);
+    std::reverse(bytes, bytes + sizeof(V));
+  }
+}
+
+template <typename V>
+void encode_packed(const V *values, size_t count, std::string *out) {
+  size_t offset = out->size();
+  out->resize(offset + count * sizeof(V));
+  if (count != 0) {
+    memcpy(&(*out)[offset], values, count * sizeof(V));
+  }
+  if constexpr (!host_little_endian()) {
+    swap_packed_bytes(reinterpret_cast<V *>(&(*out)[offset]), count);
+  }
+}
+
+template <typename V>
+void decode_packed(const void *blob, size_t bytes, V *values) {
+  if (bytes != 0) {
+    memcpy(values, blob, bytes);
+  }
+  if constexpr (!host_little_endian()) {
+    swap_packed_bytes(values, bytes / sizeof(V));
+  }
+}
+
+inline void encode_packed_length(uint32_t length, std::string *out) {
+  encode_packed(&length, 1, out);
+}
+
+// Calls fn(data, size) for each element of a length-prefixed blob.
+template <typename F>
+void decode_packed_strings(const void *blob, size_t bytes, F &&fn) {
+  const auto *data = static_cast<const char *>(blob);
+  size_t offset = 0;
+  while (offset < bytes) {
+    uint32_t length;
+    if (bytes - offset < sizeof(length)) {
+      throw std::runtime_error("Corrupt packed string column");
+    }
+    decode_packed(data + offset, sizeof(length), &length);
+    offset += sizeof(length);
+    if (bytes - offset < length) {
+      throw std::runtime_error("Corrupt packed string column");
+    }
+    fn(data + offset, (size_t)length);
+    offset += length;
+  }
+}
+
+// The raw RepeatedField accessors are deprecated in favour of
+// RepeatedFieldRef, which only hands out one element at a time. Packed
+// columns need the contiguous array to bind it in place and to fill it with
+// one memcpy, so these functions keep using them.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+template <typename V>
+void bind_packed(sqlite3_stmt *stmt, int index,
+                 const google::protobuf::Message &obj,
+                 const google::protobuf::FieldDescriptor *field) {
+  const auto &values = obj.GetReflection()->GetRepeatedField<V>(obj, field);
+  if (values.empty()) {
+    sqlite3_bind_zeroblob(stmt, index, 0);
+  } else if constexpr (host_little_endian()) {
+    // the message outlives the step, so the array is bound in place
+    sqlite3_bind_blob(stmt, index, values.data(),
+                      (int)(values.size() * sizeof(V)), SQLITE_STATIC);
+  } else {
+    std::string buffer;
+    encode_packed(values.data(), values.size(), &buffer);
+    sqlite3_bind_blob(stmt, index, buffer.data(), (int)buffer.size(),
+                      SQLITE_TRANSIENT);
+  }
+}
+
+template <typename V>
+void extract_packed(sqlite3_stmt *stmt, int i, google::protobuf::Message *obj,
+                    const google::protobuf::FieldDescriptor *field) {
+  const void *blob = sqlite3_column_blob(stmt, i);
+  size_t bytes = sqlite3_column_bytes(stmt, i);
+  if (bytes % sizeof(V) != 0) {
+    throw std::runtime_error("Corrupt packed column: " + field->name());
+  }
+  auto *values = obj->GetReflection()->MutableRepeatedField<V>(obj, field);
+  values->Resize((int)(bytes / sizeof(V)), V());
+  if (bytes != 0) {
+    decode_packed(blob, bytes, values->mutable_data());
+  }
+}
+
+inline void bind_packed_enums(sqlite3_stmt *stmt, int index,
+                              const google::protobuf::Message &obj,
+                              const google::protobuf::FieldDescriptor *field) {
+  const auto *reflection = obj.GetReflection();
+  std::string buffer;
+  for (int i = 0; i < reflection->FieldSize(obj, field); ++i) {
+    int32_t value = reflection->GetRepeatedEnumValue(obj, field, i);
+    encode_packed(&value, 1, &buffer);
+  }
+  sqlite3_bind_blob(stmt, index, buffer.data(), (int)buffer.size(),
+                    SQLITE_TRANSIENT);
+}
+
+inline void extract_packed_enums(sqlite3_stmt *stmt, int i,
+                                 google::protobuf::Message *obj,
+                                 const google::protobuf::FieldDescriptor *field) {
+  size_t bytes = sqlite3_column_bytes(stmt, i);
+  const auto *blob = static_cast<const char *>(sqlite3_column_blob(stmt, i));
+  if (bytes % sizeof(int32_t) != 0) {
+    throw std::runtime_error("Corrupt packed column: " + field->name());
+  }
+  for (size_t offset = 0; offset < bytes; offset += sizeof(int32_t)) {
+    int32_t value;
+    decode_packed(blob + offset, sizeof(value), &value);
+    obj->GetReflection()->AddEnumValue(obj, field, value);
+  }
+}
+
+inline void bind_packed_strings(sqlite3_stmt *stmt, int index,
+                                const google::protobuf::Message &obj,
+                                const google::protobuf::FieldDescriptor *field) {
+  const auto &values =
+      obj.GetReflection()->GetRepeatedPtrField<std::string>(obj, field);
+  size_t total = 0;
+  for (const auto &value : values) {
+    total += sizeof(uint32_t) + value.size();
+  }
+  std::string buffer;
+  buffer.reserve(total);
+  for (const auto &value : values) {
+    encode_packed_length((uint32_t)value.size(), &buffer);
+    buffer.append(value);
+  }
+  sqlite3_bind_blob(stmt, index, buffer.data(), (int)buffer.size(),
+                    SQLITE_TRANSIENT);
+}
+
+inline void extract_packed_strings(sqlite3_stmt *stmt, int i,
+                                   google::protobuf::Message *obj,
+                                   const google::protobuf::FieldDescriptor *field) {
+  auto *values =
+      obj->GetReflection()->MutableRepeatedPtrField<std::string>(obj, field);
+  decode_packed_strings(sqlite3_column_blob(stmt, i),
+                        sqlite3_column_bytes(stmt, i),
+                        [values](const char *data, size_t size) {
+                          values->Add()->assign(data, size);
+                        });
+}
+
+#pragma GCC diagnostic pop
+
+// One column of a table, resolved once: the field, the bind/extract pair
+// chosen from its type and its 1-based parameter index in the insert
+// statement (0 when the column is not part of it). Packed columns hold a
+// whole repeated field in one BLOB.
+struct ColumnPlan {
+  std::string name;
+  const google::protobuf::FieldDescriptor *field = nullptr;
+  FieldBinder bind = nullptr;
+  FieldExtractor extract = nullptr;
+  int index = 0;
+  bool packed = false;
+};
+
+struct ProtoDBCodecColumn {
+  const char *name;
+  FieldBinder bind;
+  FieldExtractor extract;
+};
+
+// Reflection-free column functions for T. protoc-gen-protodb specializes it
+// in <file>.protodb.h; there is no general definition, so only a
+// ProtoDBConvertor constructed with generated_codec uses it, and doing so
+// without that header included does not compile.
+template <typename T> struct ProtoDBCodec;
+
+// Selects the ProtoDBConvertor constructor that uses ProtoDBCodec<T>.
+struct GeneratedCodec {};
+inline constexpr GeneratedCodec generated_codec{};
+
+inline std::string sql_type_of(const google::protobuf::FieldDescriptor &field) {
+  switch (field.type()) {
+  case google::protobuf::FieldDescriptor::TYPE_INT32:
+  case google::protobuf::FieldDescriptor::TYPE_INT64:
+  case google::protobuf::FieldDescriptor::TYPE_UINT32:
+  case google::protobuf::FieldDescriptor::TYPE_UINT64:
+  case google::protobuf::FieldDescriptor::TYPE_SINT32:
+  case google::protobuf::FieldDescriptor::TYPE_SINT64:
+  case google::protobuf::FieldDescriptor::TYPE_FIXED32:
+  case google::protobuf::FieldDescriptor::TYPE_FIXED64:
+  case google::protobuf::FieldDescriptor::TYPE_SFIXED32:
+  case google::protobuf::FieldDescriptor::TYPE_SFIXED64:
+  case google::protobuf::FieldDescriptor::TYPE_ENUM:
+    return "INTEGER";
+  case google::protobuf::FieldDescriptor::TYPE_FLOAT:
+  case google::protobuf::FieldDescriptor::TYPE_DOUBLE:
+    return "REAL";
+  case google::protobuf::FieldDescriptor::TYPE_BOOL:
+    return "BOOLEAN";
+  case google::protobuf::FieldDescriptor::TYPE_STRING:
+    return "TEXT";
+  default:
+    return "BLOB";
+  }
+}
+
+inline FieldBinder
+select_packed_binder(const google::protobuf::FieldDescriptor &field) {
+  using google::protobuf::FieldDescriptor;
+  switch (field.cpp_type()) {
+  case FieldDescriptor::CPPTYPE_INT32:
+    return &bind_packed<int32_t>;
+  case FieldDescriptor::CPPTYPE_INT64:
+    return &bind_packed<int64_t>;
+  case FieldDescriptor::CPPTYPE_UINT32:
+    return &bind_packed<uint32_t>;
+  case FieldDescriptor::CPPTYPE_UINT64:
+    return &bind_packed<uint64_t>;
+  case FieldDescriptor::CPPTYPE_FLOAT:
+    return &bind_packed<float>;
+  case FieldDescriptor::CPPTYPE_DOUBLE:
+    return &bind_packed<double>;
+  case FieldDescriptor::CPPTYPE_BOOL:
+    return &bind_packed<bool>;
+  case FieldDescriptor::CPPTYPE_ENUM:
+    return &bind_packed_enums;
+  case FieldDescriptor::CPPTYPE_STRING:
+    return &bind_packed_strings;
+  default:
+    return nullptr;
+  }
+}
+
+inline FieldExtractor
+select_packed_extractor(const google::protobuf::FieldDescriptor &field) {
+  using google::protobuf::FieldDescriptor;
+  switch (field.cpp_type()) {
+  case FieldDescriptor::CPPTYPE_INT32:
+    return &extract_packed<int32_t>;
+  case FieldDescriptor::CPPTYPE_INT64:
+    return &extract_packed<int64_t>;
+  case FieldDescriptor::CPPTYPE_UINT32:
+    return &extract_packed<uint32_t>;
+  case FieldDescriptor::CPPTYPE_UINT64:
+    return &extract_packed<uint64_t>;
+  case FieldDescriptor::CPPTYPE_FLOAT:
+    return &extract_packed<float>;
+  case FieldDescriptor::CPPTYPE_DOUBLE:
+    return &extract_packed<double>;
+  case FieldDescriptor::CPPTYPE_BOOL:
+    return &extract_packed<bool>;
+  case FieldDescriptor::CPPTYPE_ENUM:
+    return &extract_packed_enums;
+  case FieldDescriptor::CPPTYPE_STRING:
+    return &extract_packed_strings;
+  default:
+    return nullptr;
+  }
+}
+
+inline FieldBinder
+select_binder(const google::protobuf::FieldDescriptor &field) {
+  using google::protobuf::FieldDescriptor;
+  using google::protobuf::Message;
+  if (field.is_repeated()) {
+    return [](sqlite3_stmt *, int, const Message &,
+              const FieldDescriptor *field) {
+      throw std::runtime_error("Unsupported field type: " + field->name());
+    };
+  }
+  switch (field.type()) {
+  case FieldDescriptor::TYPE_INT32:
+  case FieldDescriptor::TYPE_SINT32:
+  case FieldDescriptor::TYPE_SFIXED32:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_int(stmt, index, obj.GetReflection()->GetInt32(obj, field));
+    };
+  case FieldDescriptor::TYPE_INT64:
+  case FieldDescriptor::TYPE_SINT64:
+  case FieldDescriptor::TYPE_SFIXED64:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_int64(stmt, index,
+                         obj.GetReflection()->GetInt64(obj, field));
+    };
+  case FieldDescriptor::TYPE_UINT32:
+  case FieldDescriptor::TYPE_FIXED32:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_int(stmt, index,
+                       obj.GetReflection()->GetUInt32(obj, field));
+    };
+  case FieldDescriptor::TYPE_UINT64:
+  case FieldDescriptor::TYPE_FIXED64:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_int64(stmt, index,
+                         obj.GetReflection()->GetUInt64(obj, field));
+    };
+  case FieldDescriptor::TYPE_FLOAT:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_double(stmt, index,
+                          obj.GetReflection()->GetFloat(obj, field));
+    };
+  case FieldDescriptor::TYPE_DOUBLE:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_double(stmt, index,
+                          obj.GetReflection()->GetDouble(obj, field));
+    };
+  case FieldDescriptor::TYPE_BOOL:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_int(stmt, index, obj.GetReflection()->GetBool(obj, field));
+    };
+  case FieldDescriptor::TYPE_ENUM:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      sqlite3_bind_int(stmt, index,
+                       obj.GetReflection()->GetEnumValue(obj, field));
+    };
+  case FieldDescriptor::TYPE_STRING:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      std::string scratch;
+      const std::string &value =
+          obj.GetReflection()->GetStringReference(obj, field, &scratch);
+      sqlite3_bind_text(stmt, index, value.data(), (int)value.size(),
+                        &value == &scratch ? SQLITE_TRANSIENT : SQLITE_STATIC);
+    };
+  case FieldDescriptor::TYPE_BYTES:
+    return [](sqlite3_stmt *stmt, int index, const Message &obj,
+              const FieldDescriptor *field) {
+      std::string scratch;
+      const std::string &value =
+          obj.GetReflection()->GetStringReference(obj, field, &scratch);
+      sqlite3_bind_blob(stmt, index, value.data(), (int)value.size(),
+                        &value == &scratch ? SQLITE_TRANSIENT : SQLITE_STATIC);
+    };
+  default:
+    return [](sqlite3_stmt *, int, const Message &,
+              const FieldDescriptor *field) {
+      throw std::runtime_error("Unsupported field type: " + field->name());
+    };
+  }
+}
+
+inline FieldExtractor
+select_extractor(const google::protobuf::FieldDescriptor &field) {
+  using google::protobuf::FieldDescriptor;
+  using google::protobuf::Message;
+  if (field.is_repeated()) {
+    return [](sqlite3_stmt *, int, Message *, const FieldDescriptor *field) {
+      throw std::runtime_error("Unsupported field type: " + field->name());
+    };
+  }
+  switch (field.cpp_type()) {
+  case FieldDescriptor::CPPTYPE_INT32:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetInt32(obj, field, sqlite3_column_int(stmt, i));
+      }
+    };
+  case FieldDescriptor::CPPTYPE_INT64:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetInt64(obj, field,
+                                       sqlite3_column_int64(stmt, i));
+      }
+    };
+  case FieldDescriptor::CPPTYPE_UINT32:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetUInt32(obj, field,
+                                        sqlite3_column_int(stmt, i));
+      }
+    };
+  case FieldDescriptor::CPPTYPE_UINT64:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetUInt64(obj, field,
+                                        sqlite3_column_int64(stmt, i));
+      }
+    };
+  case FieldDescriptor::CPPTYPE_FLOAT:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetFloat(obj, field,
+                                       sqlite3_column_double(stmt, i));
+      }
+    };
+  case FieldDescriptor::CPPTYPE_DOUBLE:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetDouble(obj, field,
+                                        sqlite3_column_double(stmt, i));
+      }
+    };
+  case FieldDescriptor::CPPTYPE_BOOL:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetBool(obj, field,
+                                      sqlite3_column_int(stmt, i) != 0);
+      }
+    };
+  case FieldDescriptor::CPPTYPE_ENUM:
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        obj->GetReflection()->SetEnumValue(obj, field,
+                                           sqlite3_column_int(stmt, i));
+      }
+    };
+  case FieldDescriptor::CPPTYPE_STRING:
+    if (field.type() == FieldDescriptor::TYPE_STRING) {
+      return [](sqlite3_stmt *stmt, int i, Message *obj,
+                const FieldDescriptor *field) {
+        const auto *text =
+            reinterpret_cast<const char *>(sqlite3_column_text(stmt, i));
+        if (text != nullptr) {
+          obj->GetReflection()->SetString(
+              obj, field, std::string(text, sqlite3_column_bytes(stmt, i)));
+        }
+      };
+    }
+    return [](sqlite3_stmt *stmt, int i, Message *obj,
+              const FieldDescriptor *field) {
+      if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {
+        const auto *data =
+            reinterpret_cast<const char *>(sqlite3_column_blob(stmt, i));
+        int size = sqlite3_column_bytes(stmt, i);
+        obj->GetReflection()->SetString(
+            obj, field, data == nullptr ? std::string()
+                                        : std::string(data, size));
+      }
+    };
+  default:
+    return [](sqlite3_stmt *, int, Message *, const FieldDescriptor *field) {
+      throw std::runtime_error("Unsupported field type: " + field->name());
+    };
+  }
+}
+
+inline ColumnPlan make_column_plan(const google::protobuf::FieldDescriptor &field,
+                                   int index, bool pack_repeated = false) {
+  ColumnPlan column;
+  column.name = field.name();
+  column.field = &field;
+  column.bind = select_binder(field);
+  column.extract = select_extractor(field);
+  column.index = index;
+  if (pack_repeated && field.is_repeated() &&
+      select_packed_binder(field) != nullptr) {
+    column.bind = select_packed_binder(field);
+    column.extract = select_packed_extractor(field);
+    column.packed = true;
+  }
+  return column;
+}
+
+// Maps the result columns of a prepared statement, from first_column on,
+// onto the column plan, so rows can be decoded without any name lookups.
+inline std::vector<ColumnPlan>
+resolve_layout(sqlite3_stmt *stmt, const std::vector<ColumnPlan> &columns,
+               const google::protobuf::Descriptor *descriptor,
+               int first_column = 0) {
+  std::vector<ColumnPlan> layout;
+  int count = sqlite3_column_count(stmt);
+  layout.reserve(std::max(count - first_column, 0));
+  for (int i = first_column; i < count; ++i) {
+    const char *name = sqlite3_column_name(stmt, i);
+    auto it = std::find_if(
+        columns.begin(), columns.end(),
+        [name](const ColumnPlan &column) { return column.name == name; });
+    if (it != columns.end()) {
+      layout.push_back(*it);
+      continue;
+    }
+    const google::protobuf::FieldDescriptor *field =
+        descriptor->FindFieldByName(name);
+    if (field == nullptr) {
+      throw std::runtime_error("Unknown field name: " + std::string(name));
+    }
+    layout.push_back(make_column_plan(*field, 0));
+  }
+  return layout;
+}
+
+inline void decode_row(sqlite3_stmt *stmt,
+                       const std::vector<ColumnPlan> &layout,
+                       google::protobuf::Message *obj, int first_column = 0) {
+  for (size_t i = 0; i < layout.size(); ++i) {
+    layout[i].extract(stmt, (int)i + first_column, obj, layout[i].field);
+  }
+}
+
+// Keys usable to link rows across tables: integers, enums, bools and
+// strings, compared the way SQLite orders the bound values.
+inline bool is_key_field(const google::protobuf::FieldDescriptor &field) {
+  return !field.is_repeated() &&
+         field.cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_FLOAT &&
+         field.cpp_type() !=
+             google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE &&
+         field.cpp_type() !=
+             google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE &&
+         field.type() != google::protobuf::FieldDescriptor::TYPE_BYTES;
+}
+
+// The integer a key field is bound as, see select_binder.
+inline sqlite3_int64 key_integer(const google::protobuf::Message &obj,
+                                 const google::protobuf::FieldDescriptor *field) {
+  const auto *reflection = obj.GetReflection();
+  switch (field->cpp_type()) {
+  case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+    return reflection->GetInt32(obj, field);
+  case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+    return reflection->GetInt64(obj, field);
+  case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+    return (int32_t)reflection->GetUInt32(obj, field);
+  case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+    return (sqlite3_int64)reflection->GetUInt64(obj, field);
+  case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+    return reflection->GetBool(obj, field);
+  case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+    return reflection->GetEnumValue(obj, field);
+  default:
+    throw std::runtime_error("Unsupported key type: " + field->name());
+  }
+}
+
+// Gives an unset singular field its default value with presence, as
+// decoding a row that stored the default does.
+inline void set_field_default(google::protobuf::Message *obj,
+                              const google::protobuf::FieldDescriptor *field) {
+  using google::protobuf::FieldDescriptor;
+  const auto *reflection = obj->GetReflection();
+  if (reflection->HasField(*obj, field)) {
+    return;
+  }
+  switch (field->cpp_type()) {
+  case FieldDescriptor::CPPTYPE_INT32:
+    reflection->SetInt32(obj, field, field->default_value_int32());
+    break;
+  case FieldDescriptor::CPPTYPE_INT64:
+    reflection->SetInt64(obj, field, field->default_value_int64());
+    break;
+  case FieldDescriptor::CPPTYPE_UINT32:
+    reflection->SetUInt32(obj, field, field->default_value_uint32());
+    break;
+  case FieldDescriptor::CPPTYPE_UINT64:
+    reflection->SetUInt64(obj, field, field->default_value_uint64());
+    break;
+  case FieldDescriptor::CPPTYPE_FLOAT:
+    reflection->SetFloat(obj, field, field->default_value_float());
+    break;
+  case FieldDescriptor::CPPTYPE_DOUBLE:
+    reflection->SetDouble(obj, field, field->default_value_double());
+    break;
+  case FieldDescriptor::CPPTYPE_BOOL:
+    reflection->SetBool(obj, field, field->default_value_bool());
+    break;
+  case FieldDescriptor::CPPTYPE_ENUM:
+    reflection->SetEnumValue(obj, field,
+                             field->default_value_enum()->number());
+    break;
+  case FieldDescriptor::CPPTYPE_STRING:
+    reflection->SetString(obj, field, field->default_value_string());
+    break;
+  default:
+    break;
+  }
+}
+
+// The key as sqlite3_column_text renders the stored value.
+inline std::string key_text(const google::protobuf::Message &obj,
+                            const google::protobuf::FieldDescriptor *field) {
+  if (field->cpp_type() ==
+      google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+    return obj.GetReflection()->GetString(obj, field);
+  }
+  return std::to_string(key_integer(obj, field));
+}
+
+// Converts a lookup value to what the column binder stores for field, so
+// primary key lookups match rows written through the column plan.
+template <typename V>
+auto column_argument(const google::protobuf::FieldDescriptor &field,
+                     const V &value) {
+  using google::protobuf::FieldDescriptor;
+  bool is_text = field.cpp_type() == FieldDescriptor::CPPTYPE_STRING;
+  bool is_real = field.cpp_type() == FieldDescriptor::CPPTYPE_FLOAT ||
+                 field.cpp_type() == FieldDescriptor::CPPTYPE_DOUBLE;
+  if constexpr (std::is_convertible_v<const V &, std::string_view>) {
+    if (!is_text) {
+      throw std::runtime_error("Type mismatch for field: " + field.name());
+    }
+    return std::string_view(value);
+  } else if constexpr (std::is_integral_v<V> || std::is_enum_v<V>) {
+    if (is_text) {
+      throw std::runtime_error("Type mismatch for field: " + field.name());
+    }
+    if (field.cpp_type() == FieldDescriptor::CPPTYPE_UINT32) {
+      return (sqlite3_int64)(int32_t)value;
+    }
+    return (sqlite3_int64)value;
+  } else {
+    static_assert(std::is_floating_point_v<V>, "Unsupported lookup type");
+    if (!is_real) {
+      throw std::runtime_error("Type mismatch for field: " + field.name());
+    }
+    return (double)value;
+  }
+}
+
+// Sets field of obj to a lookup value, checked against the field type the
+// way column_argument checks it.
+template <typename V>
+void set_lookup_value(google::protobuf::Message *obj,
+                      const google::protobuf::FieldDescriptor &field,
+                      const V &value) {
+  using google::protobuf::FieldDescriptor;
+  const auto *reflection = obj->GetReflection();
+  auto mismatch = [&field]() {
+    return std::runtime_error("Type mismatch for field: " + field.name());
+  };
+  if (field.is_repeated()) {
+    throw mismatch();
+  }
+  if constexpr (std::is_convertible_v<const V &, std::string_view>) {
+    if (field.cpp_type() != FieldDescriptor::CPPTYPE_STRING) {
+      throw mismatch();
+    }
+    reflection->SetString(obj, &field, std::string(std::string_view(value)));
+  } else if constexpr (std::is_integral_v<V> || std::is_enum_v<V>) {
+    switch (field.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      reflection->SetInt32(obj, &field, (int32_t)value);
+      break;
+    case FieldDescriptor::CPPTYPE_INT64:
+      reflection->SetInt64(obj, &field, (int64_t)value);
+      break;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      reflection->SetUInt32(obj, &field, (uint32_t)value);
+      break;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      reflection->SetUInt64(obj, &field, (uint64_t)value);
+      break;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      reflection->SetBool(obj, &field, (bool)value);
+      break;
+    case FieldDescriptor::CPPTYPE_ENUM:
+      reflection->SetEnumValue(obj, &field, (int)value);
+      break;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      reflection->SetFloat(obj, &field, (float)(int64_t)value);
+      break;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      reflection->SetDouble(obj, &field, (double)(int64_t)value);
+      break;
+    default:
+      throw mismatch();
+    }
+  } else {
+    static_assert(std::is_floating_point_v<V>, "Unsupported lookup type");
+    if (field.cpp_type() == FieldDescriptor::CPPTYPE_FLOAT) {
+      reflection->SetFloat(obj, &field, (float)value);
+    } else if (field.cpp_type() == FieldDescriptor::CPPTYPE_DOUBLE) {
+      reflection->SetDouble(obj, &field, (double)value);
+    } else {
+      throw mismatch();
+    }
+  }
+}
+
+// A key as returned by column_argument, rendered the way key_text renders
+// the stored key.
+template <typename A> std::string key_argument_text(const A &argument) {
+  if constexpr (std::is_same_v<A, std::string_view>) {
+    return std::string(argument);
+  } else {
+    return std::to_string(argument);
+  }
+}
+
+// Orders the key in result column i against the key of obj.
+inline int compare_key(sqlite3_stmt *stmt, int i,
+                       const google::protobuf::Message &obj,
+                       const google::protobuf::FieldDescriptor *field) {
+  if (field->cpp_type() ==
+      google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+    std::string scratch;
+    const std::string &value =
+        obj.GetReflection()->GetStringReference(obj, field, &scratch);
+    const void *text = sqlite3_column_text(stmt, i);
+    size_t size = sqlite3_column_bytes(stmt, i);
+    int cmp = memcmp(text, value.data(), std::min(size, value.size()));
+    if (cmp != 0) {
+      return cmp;
+    }
+    return size < value.size() ? -1 : size > value.size() ? 1 : 0;
+  }
+  sqlite3_int64 left = sqlite3_column_int64(stmt, i);
+  sqlite3_int64 right = key_integer(obj, field);
+  return left < right ? -1 : left > right ? 1 : 0;
+}
+
+// A read-only memory mapping of a whole file.
+class MappedFile {
+public:
+  explicit MappedFile(const std::string &path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Failed to open " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Failed to stat " + path);
+    }
+    size_ = (size_t)info.st_size;
+    if (size_ > 0) {
+      void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        ::close(fd);
+        throw std::runtime_error("Failed to map " + path);
+      }
+      ::madvise(data, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<const uint8_t *>(data);
+    }
+    ::close(fd);
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<uint8_t *>(data_), size_);
+    }
+  }
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+private:
+  const uint8_t *data_ = nullptr;
+  size_t size_ = 0;
+};
+
+// An open incremental BLOB handle, closed on destruction.
+class BlobHandle {
+public:
+  explicit BlobHandle(sqlite3_blob *blob) : blob_(blob) {}
+
+  BlobHandle(BlobHandle &&other) noexcept : blob_(other.blob_) {
+    other.blob_ = nullptr;
+  }
+
+  BlobHandle(const BlobHandle &) = delete;
+  BlobHandle &operator=(const BlobHandle &) = delete;
+  BlobHandle &operator=(BlobHandle &&) = delete;
+
+  ~BlobHandle() { close(); }
+
+  sqlite3_blob *get() const { return blob_; }
+
+  // For a written blob the result tells whether the write succeeded.
+  int close() {
+    int rc = sqlite3_blob_close(blob_);
+    blob_ = nullptr;
+    return rc;
+  }
+
+private:
+  sqlite3_blob *blob_;
+};
+
+// Reads the varint at data, at most end - data bytes. Returns the byte
+// after it, or nullptr when the varint is truncated or too long.
+inline const uint8_t *read_varint32(const uint8_t *data, const uint8_t *end,
+                                    uint32_t *value) {
+  uint32_t result = 0;
+  for (int shift = 0; shift < 35 && data < end; shift += 7) {
+    uint8_t byte = *data++;
+    result |= (uint32_t)(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      *value = result;
+      return data;
+    }
+  }
+  return nullptr;
+}
+
+// A repeated message field stored in its own table, one row per element
+// keyed by (_parent, _ordinal): the parent's primary key and the element
+// index. The element columns follow those two.
+struct ChildTable {
+  static constexpr int key_columns = 2;
+
+  const google::protobuf::FieldDescriptor *field = nullptr;
+  std::string table_name;
+  std::vector<ColumnPlan> columns;
+  std::string scan_sql;
+  std::string lookup_sql;
+  sqlite3_stmt *insert_stmt = nullptr;
+  sqlite3_stmt *delete_stmt = nullptr;
+};
+
+struct ConvertorOptions {
+  std::string primary_key;
+  // "field.member" skips a member of a repeated message field's child table
+  std::unordered_set<std::string> skip_names;
+  bool need_create_table = false;
+  // store repeated scalar and string fields as packed BLOB columns
+  bool pack_repeated = false;
+  // secondary indexes, each a list of column names (composite when longer
+  // than one), created with the table as idx_<table>_<col>[_<col>...]
+  std::vector<std::vector<std::string>> indexes;
+  // with a primary key, write via INSERT ... ON CONFLICT DO UPDATE instead of
+  // REPLACE, so an existing row is updated in place rather than reinserted
+  bool upsert = false;
+  // memory budget of the primary-key row cache used by get(); 0 disables it
+  size_t cache_bytes = 0;
+};
+
+template <typename T>
+bool DEFAULT_SQLITE_BIND(sqlite3_stmt *, int, const std::string &, const T &) {
+  return false;
+}
+
+// template <typename T, std::function<bool(sqlite3_stmt *, int, const std::string &, const T &)> ConvF = DEFAULT_CONVERT> template <typename T, typename ConvF>
+template <typename T, bool BindF(sqlite3_stmt *, int, const std::string &,
+                                 const T &) = DEFAULT_SQLITE_BIND>
+class ProtoDBConvertor {
+public:
+  explicit ProtoDBConvertor(
+      const std::shared_ptr<SafeSQLite> &db,
+      const std::string &primary_key = "",
+      const std::unordered_set<std::string> &skip_names = {},
+      bool need_create_table = false)
+      : ProtoDBConvertor(db,
+                         positional_options_(primary_key, skip_names,
+                                             need_create_table),
+                         std::false_type()) {}
+
+  ProtoDBConvertor(const std::shared_ptr<SafeSQLite> &db,
+                   const ConvertorOptions &options)
+      : ProtoDBConvertor(db, options, std::false_type()) {}
+
+  // Binds and decodes through the generated accessors of ProtoDBCodec<T>
+  // for every column it covers, see use_codec_. T's .protodb.h must be
+  // included where this is called.
+  ProtoDBConvertor(const std::shared_ptr<SafeSQLite> &db,
+                   const ConvertorOptions &options, GeneratedCodec)
+      : ProtoDBConvertor(db, options, std::true_type()) {}
+
+private:
+  template <bool Codec>
+  ProtoDBConvertor(const std::shared_ptr<SafeSQLite> &db,
+                   const ConvertorOptions &options, std::bool_constant<Codec>)
+      : db_(db), primary_key_(options.primary_key) {
+    auto lock = db_->lock();
+
+    const google::protobuf::Descriptor *descriptor = T::descriptor();
+    table_name_ = descriptor->name();
+    select_all_sql_ = "select * from " + table_name_;
+
+    if (!primary_key_.empty()) {
+      const google::protobuf::FieldDescriptor *field =
+          descriptor->FindFieldByName(primary_key_);
+      if (field == nullptr) {
+        throw std::runtime_error("Unknown primary key: " + primary_key_);
+      }
+      primary_column_ = make_column_plan(*field, 1);
+    }
+
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+      const auto &field = *descriptor->field(i);
+      std::string field_name = field.name();
+      if (options.skip_names.find(field_name) != options.skip_names.end()) {
+        continue;
+      }
+      if (field.is_repeated() &&
+          field.cpp_type() ==
+              google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE) {
+        children_.push_back(make_child_table_(field, options));
+        continue;
+      }
+      columns_.push_back(make_column_plan(field, (int)columns_.size() + 1,
+                                          options.pack_repeated));
+    }
+
+    if (!children_.empty() &&
+        (primary_key_.empty() || !is_key_field(*primary_column_.field))) {
+      throw std::runtime_error("Child tables of " + table_name_ +
+                               " need an integer or string primary key");
+    }
+
+    for (const auto &index : options.indexes) {
+      if (index.empty()) {
+        throw std::runtime_error("Empty index on " + table_name_);
+      }
+      std::string name = "idx_" + table_name_;
+      std::string list;
+      for (const auto &column : index) {
+        find_column_(column);
+        name += "_" + column;
+        list += column + ",";
+      }
+      list.pop_back();
+      indexes_.emplace_back(name, "CREATE INDEX IF NOT EXISTS " + name +
+                                      " ON " + table_name_ + " (" + list +
+                                      ");");
+    }
+
+    if constexpr (Codec) {
+      use_codec_<ProtoDBCodec<T>>();
+    }
+
+    if (options.cache_bytes != 0) {
+      if (primary_key_.empty() || !is_key_field(*primary_column_.field)) {
+        throw std::runtime_error("Row cache of " + table_name_ +
+                                 " needs an integer or string primary key");
+      }
+      cache_ = std::make_unique<RowCache<T>>(options.cache_bytes);
+      // write() can only hand the cache what get() would decode when every
+      // field is a plain column; otherwise it drops the key instead
+      cache_writes_ = options.skip_names.empty() && children_.empty() &&
+                      BindF == DEFAULT_SQLITE_BIND<T>;
+      for (const auto &column : columns_) {
+        cache_writes_ = cache_writes_ && !column.field->is_repeated() &&
+                        column.field->cpp_type() !=
+                            google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE;
+      }
+    }
+
+    if (options.need_create_table) {
+      create_table_();
+    }
+
+    std::string values = " (";
+    for (const auto &column : columns_) {
+      values += column.name + ",";
+    }
+    values.pop_back();
+    values += ") VALUES (";
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      values += "?,";
+    }
+    values.pop_back();
+    values += ")";
+
+    std::string insert_sql = "INSERT INTO " + table_name_ + values + ";";
+    std::string upsert_sql;
+    if (!primary_key_.empty()) {
+      std::string assignments;
+      for (const auto &column : columns_) {
+        if (column.name != primary_key_) {
+          assignments += column.name + "=excluded." + column.name + ",";
+        }
+      }
+      upsert_sql = "INSERT INTO " + table_name_ + values + " ON CONFLICT(" +
+                   primary_key_ + ") DO ";
+      if (assignments.empty()) {
+        upsert_sql += "NOTHING;";
+      } else {
+        assignments.pop_back();
+        upsert_sql += "UPDATE SET " + assignments + ";";
+      }
+      insert_sql = options.upsert ? upsert_sql
+                                  : "REPLACE INTO " + table_name_ + values + ";";
+    }
+
+    if (!primary_key_.empty()) {
+      auto sql = "DELETE FROM " + table_name_ + " WHERE " + primary_key_ +
+                 " = ?";
+      if (sqlite3_prepare_v2(db_->get(), sql.c_str(), -1, &delete_stmt_,
+                             nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare statement");
+      }
+    }
+
+    if (sqlite3_prepare_v2(db_->get(), insert_sql.c_str(), -1, &insert_stmt_,
+                           nullptr) != SQLITE_OK) {
+      throw std::runtime_error("Failed to prepare statement");
+    }
+    // REPLACE deletes the old row without telling the change feed, so
+    // write_ switches to the upsert while somebody listens
+    if (!primary_key_.empty() && !options.upsert &&
+        sqlite3_prepare_v2(db_->get(), upsert_sql.c_str(), -1, &upsert_stmt_,
+                           nullptr) != SQLITE_OK) {
+      throw std::runtime_error("Failed to prepare statement");
+    }
+
+    for (auto &child : children_) {
+      std::string sql = "INSERT INTO " + child.table_name + " (_parent,_ordinal";
+      std::string values = "?,?";
+      for (const auto &column : child.columns) {
+        sql += "," + column.name;
+        values += ",?";
+      }
+      sql += ") VALUES (" + values + ");";
+      if (sqlite3_prepare_v2(db_->get(), sql.c_str(), -1, &child.insert_stmt,
+                             nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare statement");
+      }
+      sql = "DELETE FROM " + child.table_name + " WHERE _parent = ?";
+      if (sqlite3_prepare_v2(db_->get(), sql.c_str(), -1, &child.delete_stmt,
+                             nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare statement");
+      }
+    }
+  }
+
+public:
+  ~ProtoDBConvertor() {
+    sqlite3_finalize(insert_stmt_);
+    sqlite3_finalize(upsert_stmt_);
+    sqlite3_finalize(delete_stmt_);
+    for (auto &child : children_) {
+      sqlite3_finalize(child.insert_stmt);
+      sqlite3_finalize(child.delete_stmt);
+    }
+  }
+
+  bool create_table() {
+    auto lock = db_->lock();
+    return create_table_();
+  }
+
+  bool create_table_() {
+    std::string create_sql = "CREATE TABLE IF NOT EXISTS " + table_name_ + " (";
+    for (const auto &column : columns_) {
+      std::string field_type =
+          column.packed ? "BLOB" : sql_type_of(*column.field);
+      if (primary_key_ == column.name) {
+        create_sql += column.name + " " + field_type +
+                      " PRIMARY KEY NOT NULL ON CONFLICT REPLACE,";
+      } else {
+        create_sql += column.name + " " + field_type + ",";
+      }
+    }
+    create_sql.pop_back();
+    create_sql += ");";
+
+    for (const auto &child : children_) {
+      create_sql += "CREATE TABLE IF NOT EXISTS " + child.table_name +
+                    " (_parent " + sql_type_of(*primary_column_.field) +
+                    " NOT NULL,_ordinal INTEGER NOT NULL,";
+      for (const auto &column : child.columns) {
+        create_sql += column.name + " " +
+                      (column.packed ? "BLOB" : sql_type_of(*column.field)) +
+                      ",";
+      }
+      create_sql += "PRIMARY KEY (_parent,_ordinal)) WITHOUT ROWID;";
+    }
+    for (const auto &index : indexes_) {
+      create_sql += index.second;
+    }
+
+    char *errmsg;
+    if (sqlite3_exec(db_->get(), create_sql.c_str(), nullptr, nullptr,
+                     &errmsg) != SQLITE_OK) {
+      std::cerr << "Failed to create table: " << errmsg;
+      sqlite3_free(errmsg);
+      return false;
+    }
+
+    return true;
+  }
+
+  void write(const T &obj) {
+    auto lock = db_->lock();
+    if (children_.empty()) {
+      write_(obj);
+    } else {
+      SafeSQLite::Transaction transaction(*db_);
+      write_(obj);
+      transaction.commit();
+    }
+    cache_written_(obj);
+  }
+
+  // Rows are committed in chunks of batch_size(); a failing row rolls back
+  // its whole chunk, while chunks committed before it are kept.
+  void write(const std::vector<T> &obj) {
+    auto lock = db_->lock();
+    size_t chunk = batch_size_ == 0 ? obj.size() : batch_size_;
+    for (size_t begin = 0; begin < obj.size(); begin += chunk) {
+      SafeSQLite::Transaction transaction(*db_);
+      size_t end = std::min(obj.size(), begin + chunk);
+      for (size_t i = begin; i < end; ++i) {
+        write_(obj[i]);
+      }
+      transaction.commit();
+      for (size_t i = begin; i < end; ++i) {
+        cache_written_(obj[i]);
+      }
+    }
+  }
+
+  size_t batch_size() const { return batch_size_; }
+  void set_batch_size(size_t batch_size) { batch_size_ = batch_size; }
+
+  // Updates only the fields named in mask (top-level field names) of the
+  // row whose primary key matches obj. Naming a repeated message field
+  // rewrites its child table. Returns false if no such row exists; a mask
+  // naming nothing but the primary key changes nothing and only reports
+  // whether the row exists.
+  bool update(const T &obj, const google::protobuf::FieldMask &mask) {
+    const google::protobuf::Descriptor *descriptor = T::descriptor();
+    std::vector<const google::protobuf::FieldDescriptor *> fields;
+    for (const auto &path : mask.paths()) {
+      const auto *field = descriptor->FindFieldByName(path);
+      if (field == nullptr || !stores_(field)) {
+        throw std::runtime_error("Unknown field in mask: " + path);
+      }
+      fields.push_back(field);
+    }
+    return update_(obj, fields);
+  }
+
+  // Updates the fields present in obj (HasField, or non-empty when
+  // repeated). Proto3 fields without presence are only written when they
+  // differ from their default; use the FieldMask overload to clear them.
+  // As with the mask, obj with only its key set reports whether the row
+  // exists.
+  bool update(const T &obj) {
+    std::vector<const google::protobuf::FieldDescriptor *> fields;
+    obj.GetReflection()->ListFields(obj, &fields);
+    fields.erase(std::remove_if(fields.begin(), fields.end(),
+                                [this](const auto *field) {
+                                  return !stores_(field);
+                                }),
+                 fields.end());
+    return update_(obj, fields);
+  }
+
+  void bind_column_(sqlite3_stmt *stmt, int index, const ColumnPlan &column,
+                    const T &obj) const {
+    if (!BindF(stmt, index, column.name, obj)) {
+      column.bind(stmt, index, obj, column.field);
+    }
+  }
+
+  void write_(const T &obj) {
+    sqlite3_stmt *stmt = insert_stmt_;
+    if (upsert_stmt_ != nullptr && db_->recording_changes()) {
+      stmt = upsert_stmt_;
+    }
+    {
+      ScopedLatency timer(metrics_.bind);
+      if (codec_rows_) {
+        codec_bind_(stmt, obj);
+      } else {
+        for (const auto &column : columns_) {
+          bind_column_(stmt, column.index, column, obj);
+        }
+      }
+    }
+    step_(stmt, obj);
+    for (auto &child : children_) {
+      write_children_(child, obj);
+    }
+    metrics_.rows_written.add();
+  }
+
+  void write_children_(ChildTable &child, const T &obj) {
+    bind_column_(child.delete_stmt, 1, primary_column_, obj);
+    step_(child.delete_stmt);
+    const auto *reflection = obj.GetReflection();
+    int size = reflection->FieldSize(obj, child.field);
+    for (int i = 0; i < size; ++i) {
+      const auto &element = reflection->GetRepeatedMessage(obj, child.field, i);
+      bind_column_(child.insert_stmt, 1, primary_column_, obj);
+      sqlite3_bind_int(child.insert_stmt, 2, i);
+      for (const auto &column : child.columns) {
+        column.bind(child.insert_stmt, column.index, element, column.field);
+      }
+      step_(child.insert_stmt);
+    }
+  }
+
+  void step_(sqlite3_stmt *stmt) {
+    ScopedLatency timer(metrics_.step);
+    int rc = sqlite3_step(stmt);
+    if (rc != SQLITE_DONE) {
+      std::string error = sqlite3_errmsg(db_->get());
+      sqlite3_reset(stmt);
+      throw std::runtime_error("Failed to write " + table_name_ + ": " +
+                               error);
+    }
+    sqlite3_reset(stmt);
+  }
+
+  // step_ for a statement changing only the row with obj's primary key;
+  // while the change feed records, its changes are recorded with that key.
+  void step_(sqlite3_stmt *stmt, const T &obj) {
+    if (primary_key_.empty() || !db_->recording_changes() ||
+        !is_key_field(*primary_column_.field)) {
+      step_(stmt);
+      return;
+    }
+    SafeSQLite::ChangeKey key(*db_, table_name_,
+                              key_text(obj, primary_column_.field));
+    step_(stmt);
+  }
+
+  // How a cursor fills repeated message fields: not at all, by merging an
+  // ordered scan of each child table with parents ordered by primary key,
+  // or by one indexed lookup per parent for queries in any other order.
+  enum class ChildMode { None, Merge, Lookup };
+
+  // Steps a query lazily. The row returned by value() is cleared and reused
+  // for every step, so a scan runs in constant memory; take() moves the
+  // current row out when the caller wants to keep it.
+  //
+  // A merging cursor scans each whole child table unless it is given
+  // merged, one bound child query per child table.
+  class Cursor {
+  public:
+    Cursor(const ProtoDBConvertor &owner, SafeSQLite::Reader reader,
+           CachedStatement stmt, ChildMode mode,
+           std::vector<CachedStatement> merged = {})
+        : owner_(&owner), reader_(std::move(reader)), stmt_(std::move(stmt)),
+          layout_(resolve_layout(stmt_.get(), owner.columns_,
+                                 T::descriptor())),
+          mode_(mode) {
+      whole_row_ =
+          owner.codec_rows_ && layout_.size() == owner.columns_.size();
+      for (size_t i = 0; whole_row_ && i < layout_.size(); ++i) {
+        whole_row_ = layout_[i].field == owner.columns_[i].field;
+      }
+      if (mode_ == ChildMode::None) {
+        return;
+      }
+      for (size_t c = 0; c < owner.children_.size(); ++c) {
+        const auto &child = owner.children_[c];
+        ChildState state{
+            merged.empty()
+                ? CachedStatement(reader_.statements(),
+                                  mode_ == ChildMode::Merge ? child.scan_sql
+                                                            : child.lookup_sql)
+                : std::move(merged[c]),
+            {}, false};
+        state.layout = resolve_layout(state.stmt.get(), child.columns,
+                                      child.field->message_type(),
+                                      ChildTable::key_columns);
+        if (mode_ == ChildMode::Merge) {
+          state.has_row = step_(state.stmt.get());
+        }
+        children_.push_back(std::move(state));
+      }
+    }
+
+    Cursor(Cursor &&other) noexcept = default;
+    Cursor(const Cursor &) = delete;
+    Cursor &operator=(const Cursor &) = delete;
+    Cursor &operator=(Cursor &&) = delete;
+
+    bool next() { return next(&current_); }
+
+    // Decodes the next row into obj instead of value(), e.g. a message
+    // owned by an arena.
+    bool next(T *obj) {
+      if (!step()) {
+        return false;
+      }
+      decode(obj);
+      return true;
+    }
+
+    // next(obj) in two halves, so the caller only creates obj once a row
+    // is known to be there.
+    bool step() { return step_(stmt_.get()); }
+
+    void decode(T *obj) {
+      ScopedLatency timer(owner_->metrics_.decode);
+      obj->Clear();
+      if (whole_row_) {
+        owner_->codec_decode_(stmt_.get(), obj);
+      } else {
+        decode_row(stmt_.get(), layout_, obj);
+      }
+      attach_children_(obj);
+      owner_->metrics_.rows_read.add();
+    }
+
+    T &value() { return current_; }
+    T take() { return std::move(current_); }
+
+    const SafeSQLite::Reader &reader() const { return reader_; }
+
+    bool selects(const google::protobuf::FieldDescriptor *field) const {
+      return std::any_of(
+          layout_.begin(), layout_.end(),
+          [field](const ColumnPlan &column) { return column.field == field; });
+    }
+
+  private:
+    struct ChildState {
+      CachedStatement stmt;
+      std::vector<ColumnPlan> layout;
+      bool has_row;
+    };
+
+    bool step_(sqlite3_stmt *stmt) {
+      ScopedLatency timer(owner_->metrics_.step);
+      int rc = sqlite3_step(stmt);
+      if (rc == SQLITE_ROW) {
+        return true;
+      }
+      if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Error querying database: " +
+                                 std::string(sqlite3_errmsg(reader_.get())));
+      }
+      return false;
+    }
+
+    void attach_children_(T *obj) {
+      const auto *key = owner_->primary_column_.field;
+      for (size_t c = 0; c < children_.size(); ++c) {
+        const auto *field = owner_->children_[c].field;
+        auto &state = children_[c];
+        sqlite3_stmt *stmt = state.stmt.get();
+        if (mode_ == ChildMode::Lookup) {
+          owner_->primary_column_.bind(stmt, 1, *obj, key);
+          while (step_(stmt)) {
+            decode_row(stmt, state.layout,
+                       obj->GetReflection()->AddMessage(obj, field),
+                       ChildTable::key_columns);
+          }
+          sqlite3_reset(stmt);
+          continue;
+        }
+        while (state.has_row) {
+          int cmp = compare_key(stmt, 0, *obj, key);
+          if (cmp > 0) {
+            break;
+          }
+          if (cmp == 0) {
+            decode_row(stmt, state.layout,
+                       obj->GetReflection()->AddMessage(obj, field),
+                       ChildTable::key_columns);
+          }
+          state.has_row = step_(stmt);
+        }
+      }
+    }
+
+    const ProtoDBConvertor *owner_;
+    SafeSQLite::Reader reader_;
+    CachedStatement stmt_;
+    std::vector<ColumnPlan> layout_;
+    ChildMode mode_;
+    // the row is exactly the generated codec's columns, decode it in one go
+    bool whole_row_ = false;
+    std::vector<ChildState> children_;
+    T current_;
+  };
+
+  // Runs sql with its ? placeholders bound to args, in order, on a reader
+  // connection. Statements come from that connection's statement cache.
+  // Child rows are merged in from one query per child table when sql ends
+  // in "order by <primary key> [asc] [limit <n> [offset <m>]]" (words
+  // compared case-insensitively, a trailing ';' allowed, no parentheses
+  // after the ORDER BY); any other sql looks them up per row. Pass the mode
+  // explicitly to skip that guess. Without the primary key among the
+  // selected columns, children are not filled, as with read().
+  template <typename... Args>
+  Cursor cursor(const std::string &sql, const Args &...args) {
+    return open_cursor_(sql, child_mode_(sql), args...);
+  }
+
+  // As above with the child mode chosen by the caller. ChildMode::Merge is
+  // only correct when sql returns its rows in ascending primary key order.
+  template <typename... Args>
+  Cursor cursor(ChildMode mode, const std::string &sql, const Args &...args) {
+    return open_cursor_(sql, mode, args...);
+  }
+
+  Cursor cursor() {
+    if (children_.empty()) {
+      return open_cursor_(select_all_sql_, ChildMode::None);
+    }
+    return open_cursor_(select_all_sql_ + " order by " + primary_key_,
+                        ChildMode::Merge);
+  }
+
+  // Calls fn(T &) for every row without materializing the result set. The
+  // row object is reused, fn may move it out to keep it. A fn returning bool
+  // stops the scan by returning false. Returns the number of rows visited.
+  template <typename F, typename... Args>
+  size_t for_each(const std::string &sql, F &&fn, const Args &...args) {
+    return visit_(cursor(sql, args...), fn);
+  }
+
+  template <typename F, typename... Args>
+  size_t for_each(ChildMode mode, const std::string &sql, F &&fn,
+                  const Args &...args) {
+    return visit_(cursor(mode, sql, args...), fn);
+  }
+
+  template <typename F> size_t for_each(F &&fn) { return visit_(cursor(), fn); }
+
+  // Child tables are filled with one ordered query each, merged into the
+  // parents through a hash of their keys. All queries run in one read
+  // transaction; without a reader pool that holds the writer lock.
+  template <typename... Args>
+  std::vector<T> read(const std::string &sql, const Args &...args) {
+    std::vector<T> result;
+    SafeSQLite::Reader reader = db_->reader();
+    ReadSnapshot snapshot(*db_, reader.get(), !children_.empty());
+    Cursor rows =
+        open_cursor_(std::move(reader), sql, ChildMode::None, args...);
+    while (rows.next()) {
+      result.push_back(rows.take());
+    }
+    if (!children_.empty() && !result.empty() &&
+        rows.selects(primary_column_.field)) {
+      std::vector<T *> parents;
+      parents.reserve(result.size());
+      for (auto &row : result) {
+        parents.push_back(&row);
+      }
+      read_children_(rows.reader(), sql, parents, args...);
+    }
+    snapshot.end();
+    return result;
+  }
+
+  std::vector<T> read() { return read(select_all_sql_); }
+
+  // Rows whose column field equals value. The value is checked against the
+  // field type, set on a message and bound by the column's own binder, so
+  // it is encoded exactly as writes store it; declare field in
+  // ConvertorOptions::indexes to avoid a full scan.
+  template <typename V>
+  std::vector<T> find_by(const std::string &field, const V &value) {
+    const ColumnPlan &column = find_column_(field);
+    return read(select_all_sql_ + " where " + column.name + " = ?",
+                ColumnValue(*this, column, value));
+  }
+
+  // Rows with lo <= field <= hi, ordered by field. The bounds are bound
+  // like find_by's value and may differ in type, e.g. two string literals.
+  template <typename Lo, typename Hi>
+  std::vector<T> find_range(const std::string &field, const Lo &lo,
+                            const Hi &hi) {
+    const ColumnPlan &column = find_column_(field);
+    return read(select_all_sql_ + " where " + column.name + " >= ? and " +
+                    column.name + " <= ? order by " + column.name,
+                ColumnValue(*this, column, lo), ColumnValue(*this, column, hi));
+  }
+
+  // Builds every row, strings and children included, on arena. The messages
+  // are owned by the arena, so the whole result is freed by resetting it.
+  template <typename... Args>
+  std::vector<T *> read(google::protobuf::Arena *arena, const std::string &sql,
+                        const Args &...args) {
+    std::vector<T *> result;
+    SafeSQLite::Reader reader = db_->reader();
+    ReadSnapshot snapshot(*db_, reader.get(), !children_.empty());
+    Cursor rows =
+        open_cursor_(std::move(reader), sql, ChildMode::None, args...);
+    while (rows.step()) {
+      T *obj = google::protobuf::Arena::CreateMessage<T>(arena);
+      rows.decode(obj);
+      result.push_back(obj);
+    }
+    if (!children_.empty() && !result.empty() &&
+        rows.selects(primary_column_.field)) {
+      read_children_(rows.reader(), sql, result, args...);
+    }
+    snapshot.end();
+    return result;
+  }
+
+  std::vector<T *> read(google::protobuf::Arena *arena) {
+    return read(arena, select_all_sql_);
+  }
+
+  void delete_obj(const T &obj) {
+    if (primary_key_.empty()) {
+      return;
+    }
+
+    auto lock = db_->lock();
+    bind_column_(delete_stmt_, 1, primary_column_, obj);
+    int deleted;
+    if (children_.empty()) {
+      step_(delete_stmt_, obj);
+      deleted = sqlite3_changes(db_->get());
+    } else {
+      SafeSQLite::Transaction transaction(*db_);
+      step_(delete_stmt_, obj);
+      deleted = sqlite3_changes(db_->get());
+      for (auto &child : children_) {
+        bind_column_(child.delete_stmt, 1, primary_column_, obj);
+        step_(child.delete_stmt);
+      }
+      transaction.commit();
+    }
+    metrics_.rows_deleted.add(deleted);
+    if (cache_) {
+      cache_->erase(key_text(obj, primary_column_.field));
+    }
+  }
+
+  // The row whose primary key equals key, or nullopt. With
+  // ConvertorOptions::cache_bytes set, rows are kept in an LRU row cache:
+  // hits skip the connection lock, prepare and decode entirely, write()
+  // refreshes cached rows and delete_obj(), update() and write_blob() drop
+  // them. Changes made with raw SQL are not seen by the cache.
+  template <typename K> std::optional<T> get(const K &key) {
+    if (primary_key_.empty()) {
+      throw std::runtime_error("Cannot get from " + table_name_ +
+                               " without a primary key");
+    }
+    auto argument = column_argument(*primary_column_.field, key);
+    std::string sql = select_all_sql_ + " where " + primary_key_ + " = ?";
+    if (!cache_) {
+      std::vector<T> rows = read(sql, argument);
+      if (rows.empty()) {
+        return std::nullopt;
+      }
+      return std::move(rows.front());
+    }
+
+    std::string text = key_argument_text(argument);
+    if (auto cached = cache_->find(text)) {
+      return *cached;
+    }
+    // rows read while a transaction is open may never be committed
+    bool committed;
+    uint64_t version;
+    {
+      auto lock = db_->lock();
+      committed = sqlite3_get_autocommit(db_->get());
+      version = cache_->version();
+    }
+    std::vector<T> rows = read(sql, argument);
+    if (rows.empty()) {
+      return std::nullopt;
+    }
+    if (committed) {
+      cache_->fill(text, std::make_shared<const T>(rows.front()), version);
+    }
+    return std::move(rows.front());
+  }
+
+  struct ChangeEvent {
+    ChangeOp op;
+    sqlite3_int64 rowid;
+    // the primary key as text (decimal for integer keys, uint32 as int32
+    // like the column); empty for rows not changed through a convertor
+    std::string key;
+    // with decode_rows, the row as read back at delivery time; empty for
+    // deletes and for rows deleted again before they were read
+    std::optional<T> row;
+  };
+
+  // Calls fn(const std::vector<ChangeEvent> &) with the committed changes
+  // to this table, one call per transaction, on the change feed thread of
+  // the SafeSQLite (see SafeSQLite::subscribe). With decode_rows, inserted
+  // and updated rows are read back by rowid and decoded, children
+  // included, so consumers touch only the rows that changed. Without a
+  // reader pool the read runs on the writer connection. Rows written,
+  // updated or deleted through a convertor carry their primary key, and
+  // while anybody listens write() upserts instead of REPLACE so a row keeps
+  // its rowid. The subscription must not outlive the convertor.
+  template <typename F>
+  ChangeSubscription subscribe(F &&fn, bool decode_rows = false) {
+    std::string by_rowid = select_all_sql_ + " where rowid = ?";
+    uint64_t id = db_->subscribe(
+        [this, fn = std::forward<F>(fn), decode_rows,
+         by_rowid](const std::vector<Change> &changes) {
+          std::vector<ChangeEvent> events;
+          for (const auto &change : changes) {
+            if (change.table != table_name_) {
+              continue;
+            }
+            ChangeEvent event{change.op, change.rowid, change.key,
+                              std::nullopt};
+            if (decode_rows && change.op != ChangeOp::Delete) {
+              std::vector<T> rows = read(by_rowid, change.rowid);
+              if (!rows.empty()) {
+                event.row = std::move(rows.front());
+              }
+            }
+            events.push_back(std::move(event));
+          }
+          if (!events.empty()) {
+            fn(events);
+          }
+        });
+    return ChangeSubscription(db_, id);
+  }
+
+  // Zero when the convertor has no row cache.
+  RowCacheStats cache_stats() const {
+    return cache_ ? cache_->stats() : RowCacheStats{};
+  }
+
+  void clear_cache() {
+    if (cache_) {
+      cache_->clear();
+    }
+  }
+
+  // Splits the table into rowid ranges scanned by up to threads workers,
+  // each on its own read-only connection, so decoding uses several cores.
+  // fn(T &) is called concurrently from the workers and must be thread
+  // safe. Databases without a file are scanned on the calling thread.
+  template <typename F>
+  size_t parallel_for_each(F &&fn, size_t threads = 0) {
+    std::atomic<size_t> count{0};
+    parallel_scan_(threads, [&](size_t, Cursor &rows) {
+      size_t visited = 0;
+      while (rows.next()) {
+        fn(rows.value());
+        ++visited;
+      }
+      count += visited;
+    });
+    return count;
+  }
+
+  // Every row via parallel_for_each's partitions, decoded into one buffer
+  // per worker. ordered joins the chunks in partition order, otherwise in
+  // the order the workers finish.
+  std::vector<T> parallel_read(size_t threads = 0, bool ordered = false) {
+    std::vector<std::vector<T>> chunks;
+    std::vector<size_t> finished;
+    std::mutex mutex;
+    parallel_scan_(threads, [&](size_t partition, Cursor &rows) {
+      std::vector<T> chunk;
+      while (rows.next()) {
+        chunk.push_back(rows.take());
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      if (chunks.size() <= partition) {
+        chunks.resize(partition + 1);
+      }
+      chunks[partition] = std::move(chunk);
+      finished.push_back(partition);
+    });
+    if (ordered) {
+      std::sort(finished.begin(), finished.end());
+    }
+    size_t total = 0;
+    for (const auto &chunk : chunks) {
+      total += chunk.size();
+    }
+    std::vector<T> result;
+    result.reserve(total);
+    for (size_t partition : finished) {
+      std::move(chunks[partition].begin(), chunks[partition].end(),
+                std::back_inserter(result));
+    }
+    return result;
+  }
+
+  // Streams the bytes or string column field of the row with primary key
+  // key to fn(const char *data, size_t size) in chunk_size pieces through
+  // incremental BLOB I/O, so large payloads are never held whole. Returns
+  // the column size.
+  template <typename K, typename F>
+  size_t read_blob(const std::string &field, const K &key, F &&fn,
+                   size_t chunk_size = 1 << 16) {
+    const ColumnPlan &column = blob_column_(field);
+    check_chunk_size_(chunk_size);
+    SafeSQLite::Reader reader = db_->reader();
+    // closed before the reader goes back to the pool, even if fn throws
+    BlobHandle blob = open_blob_(reader.get(), reader.statements(), column,
+                                 key, 0);
+    int size = sqlite3_blob_bytes(blob.get());
+    std::vector<char> buffer(std::min<size_t>(chunk_size, size));
+    for (int offset = 0; offset < size;) {
+      int count = std::min<int>((int)buffer.size(), size - offset);
+      int rc = sqlite3_blob_read(blob.get(), buffer.data(), count, offset);
+      if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to read blob " + field + ": " +
+                                 sqlite3_errstr(rc));
+      }
+      fn(buffer.data(), (size_t)count);
+      offset += count;
+    }
+    return size;
+  }
+
+  // Replaces column field of the row with key by size bytes, pulled in
+  // chunk_size pieces from fill(char *data, size_t size). The column is
+  // sized with zeroblob() and written with incremental BLOB I/O.
+  template <typename K, typename F>
+  void write_blob(const std::string &field, const K &key, size_t size,
+                  F &&fill, size_t chunk_size = 1 << 16) {
+    const ColumnPlan &column = blob_column_(field);
+    check_chunk_size_(chunk_size);
+    auto lock = db_->lock();
+    SafeSQLite::Transaction transaction(*db_);
+    {
+      CachedStatement stmt(db_->statements(),
+                           "UPDATE " + table_name_ + " SET " + column.name +
+                               " = zeroblob(?) WHERE " + primary_key_ +
+                               " = ?;");
+      ColumnValue row(*this, primary_column_, key);
+      bind_values(stmt.get(), (sqlite3_int64)size, row);
+      step_(stmt.get(), row.message());
+    }
+    BlobHandle blob = open_blob_(db_->get(), db_->statements(), column, key, 1);
+    std::vector<char> buffer(std::min(chunk_size, size));
+    for (size_t offset = 0; offset < size;) {
+      size_t count = std::min(buffer.size(), size - offset);
+      fill(buffer.data(), count);
+      int rc = sqlite3_blob_write(blob.get(), buffer.data(), (int)count,
+                                  (int)offset);
+      if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to write blob " + field + ": " +
+                                 sqlite3_errstr(rc));
+      }
+      offset += count;
+    }
+    if (blob.close() != SQLITE_OK) {
+      throw std::runtime_error("Failed to write blob " + field + ": " +
+                               sqlite3_errmsg(db_->get()));
+    }
+    metrics_.rows_written.add();
+    transaction.commit();
+    if (cache_) {
+      cache_->erase(
+          key_argument_text(column_argument(*primary_column_.field, key)));
+    }
+  }
+
+  struct Page {
+    std::vector<T> rows;
+    // pass to the next page() call; empty once the table is exhausted
+    std::string next_token;
+  };
+
+  // Keyset pagination: up to limit rows after token in primary key order,
+  // decoding only fields (all columns when empty; the primary key is always
+  // included). Unlike OFFSET, every page costs the same however deep it is.
+  Page page(const std::vector<std::string> &fields, size_t limit,
+            const std::string &token = "") {
+    if (primary_key_.empty() || !is_key_field(*primary_column_.field)) {
+      throw std::runtime_error("Paging " + table_name_ +
+                               " needs an integer or string primary key");
+    }
+    if (limit == 0) {
+      throw std::runtime_error("Page limit must be positive");
+    }
+
+    std::string sql = "select " + primary_key_;
+    for (const auto &field : fields) {
+      auto it = std::find_if(
+          columns_.begin(), columns_.end(),
+          [&field](const ColumnPlan &column) { return column.name == field; });
+      if (it == columns_.end()) {
+        throw std::runtime_error("Unknown column " + field + " in " +
+                                 table_name_);
+      }
+      if (field != primary_key_) {
+        sql += "," + field;
+      }
+    }
+    if (fields.empty()) {
+      sql = "select *";
+    }
+    sql += " from " + table_name_;
+
+    Page page;
+    page.rows.reserve(limit);
+    auto collect = [&](Cursor rows) {
+      while (rows.next()) {
+        page.rows.push_back(rows.take());
+      }
+    };
+    if (token.empty()) {
+      collect(open_cursor_(sql + " order by " + primary_key_ + " limit ?",
+                           ChildMode::None, (sqlite3_int64)limit));
+    } else {
+      sql += " where " + primary_key_ + " > ? order by " + primary_key_ +
+             " limit ?";
+      if (primary_column_.field->cpp_type() ==
+          google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+        collect(open_cursor_(sql, ChildMode::None, token,
+                             (sqlite3_int64)limit));
+      } else {
+        collect(open_cursor_(sql, ChildMode::None,
+                             (sqlite3_int64)std::stoll(token),
+                             (sqlite3_int64)limit));
+      }
+    }
+    if (page.rows.size() == limit) {
+      page.next_token = key_text(page.rows.back(), primary_column_.field);
+    }
+    return page;
+  }
+
+  // Streams the whole table into path as varint length-delimited messages,
+  // the format bulk_load reads, holding one row at a time.
+  size_t export_to(const std::string &path, bool snapshot = true) {
+    if (children_.empty()) {
+      return export_(path, snapshot, select_all_sql_, ChildMode::None);
+    }
+    return export_(path, snapshot,
+                   select_all_sql_ + " order by " + primary_key_,
+                   ChildMode::Merge);
+  }
+
+  // Streams the rows of a query. With snapshot the scan runs in one read
+  // transaction, so parents and child tables stay consistent while writers
+  // go on; without a reader pool that holds the writer lock throughout.
+  template <typename... Args>
+  size_t export_to(const std::string &path, bool snapshot,
+                   const std::string &sql, const Args &...args) {
+    return export_(path, snapshot, sql, child_mode_(sql), args...);
+  }
+
+  // Loads a file of varint length-delimited T messages, as written by
+  // writeDelimitedTo. The file is mapped and parsed into one reused
+  // message. For the load the connection runs with synchronous=OFF and a
+  // large cache, declared indexes are dropped and rebuilt at the end, and
+  // rows are committed every transaction_rows. Returns the row count.
+  size_t bulk_load(const std::string &path,
+                   size_t transaction_rows = 100000) {
+    MappedFile file(path);
+    auto lock = db_->lock();
+    FastLoad fast_load(*this);
+    if (cache_) {
+      cache_->clear();
+    }
+
+    T obj;
+    size_t count = 0;
+    const uint8_t *data = file.data();
+    const uint8_t *end = data + file.size();
+    size_t chunk = transaction_rows == 0 ? file.size() : transaction_rows;
+    while (data < end) {
+      SafeSQLite::Transaction transaction(*db_);
+      for (size_t i = 0; i < chunk && data < end; ++i) {
+        size_t offset = data - file.data();
+        uint32_t size;
+        data = read_varint32(data, end, &size);
+        if (data == nullptr || size > (size_t)(end - data)) {
+          throw std::runtime_error("Truncated message in " + path +
+                                   " at offset " + std::to_string(offset));
+        }
+        if (!obj.ParseFromArray(data, (int)size)) {
+          throw std::runtime_error("Failed to parse message in " + path +
+                                   " at offset " + std::to_string(offset));
+        }
+        data += size;
+        write_(obj);
+        ++count;
+      }
+      transaction.commit();
+    }
+    fast_load.finish();
+    return count;
+  }
+
+  const std::vector<ColumnPlan> &columns() const { return columns_; }
+  const std::vector<ChildTable> &children() const { return children_; }
+  const std::shared_ptr<SafeSQLite> &db() const { return db_; }
+
+  ConvertorMetricsSnapshot metrics() const { return metrics_.snapshot(); }
+
+private:
+  // A lookup value held in a message of its own and bound through
+  // bind_column_. Strings are bound in place, so it must outlive the query.
+  class ColumnValue {
+  public:
+    template <typename V>
+    ColumnValue(const ProtoDBConvertor &owner, const ColumnPlan &column,
+                const V &value)
+        : owner_(&owner), column_(&column) {
+      set_lookup_value(&obj_, *column.field, value);
+    }
+
+    void bind(sqlite3_stmt *stmt, int index) const {
+      owner_->bind_column_(stmt, index, *column_, obj_);
+    }
+
+    const T &message() const { return obj_; }
+
+  private:
+    const ProtoDBConvertor *owner_;
+    const ColumnPlan *column_;
+    T obj_;
+  };
+
+  static ConvertorOptions
+  positional_options_(const std::string &primary_key,
+                      const std::unordered_set<std::string> &skip_names,
+                      bool need_create_table) {
+    ConvertorOptions options;
+    options.primary_key = primary_key;
+    options.skip_names = skip_names;
+    options.need_create_table = need_create_table;
+    return options;
+  }
+
+  // Swaps the reflection binders and extractors for the generated ones,
+  // and binds/decodes whole rows directly when the table has exactly the
+  // generated columns and no custom BindF is involved.
+  template <typename Codec> void use_codec_() {
+    auto find = [](const std::string &name) -> const ProtoDBCodecColumn * {
+      for (const auto *column = Codec::columns();
+           column->name != nullptr; ++column) {
+        if (name == column->name) {
+          return column;
+        }
+      }
+      return nullptr;
+    };
+    if (const auto *codec = find(primary_column_.name)) {
+      primary_column_.bind = codec->bind;
+      primary_column_.extract = codec->extract;
+    }
+    bool whole_rows = BindF == DEFAULT_SQLITE_BIND<T> &&
+                      columns_.size() == Codec::column_count;
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      auto &column = columns_[i];
+      const ProtoDBCodecColumn *codec =
+          column.packed ? nullptr : find(column.name);
+      if (codec == nullptr) {
+        whole_rows = false;
+        continue;
+      }
+      column.bind = codec->bind;
+      column.extract = codec->extract;
+      whole_rows = whole_rows && codec == Codec::columns() + i;
+    }
+    codec_rows_ = whole_rows;
+    codec_bind_ = &Codec::bind;
+    codec_decode_ = &Codec::decode;
+  }
+
+  // Called with the connection lock held after obj was written. Outside a
+  // transaction the row is committed and replaces the cached one; inside
+  // one the key is dropped, and get() does not refill it until the
+  // transaction ends.
+  void cache_written_(const T &obj) {
+    if (!cache_) {
+      return;
+    }
+    std::string key = key_text(obj, primary_column_.field);
+    if (!cache_writes_ || !sqlite3_get_autocommit(db_->get())) {
+      cache_->erase(key);
+      return;
+    }
+    auto row = std::make_shared<T>(obj);
+    row->DiscardUnknownFields();
+    // decoding sets every column, including those obj left unset
+    for (const auto &column : columns_) {
+      set_field_default(row.get(), column.field);
+    }
+    cache_->put(key, std::move(row));
+  }
+
+  // Switches the connection to bulk-load settings and drops the declared
+  // indexes; finish() or destruction rebuilds them and restores the pragmas.
+  class FastLoad {
+  public:
+    explicit FastLoad(ProtoDBConvertor &owner)
+        : owner_(owner), synchronous_(owner.pragma_("synchronous")),
+          cache_size_(owner.pragma_("cache_size")) {
+      owner_.exec_("PRAGMA synchronous=OFF;PRAGMA cache_size=-262144;");
+      for (const auto &index : owner_.indexes_) {
+        owner_.exec_("DROP INDEX IF EXISTS " + index.first + ";");
+      }
+    }
+
+    FastLoad(const FastLoad &) = delete;
+    FastLoad &operator=(const FastLoad &) = delete;
+
+    ~FastLoad() {
+      try {
+        finish();
+      } catch (const std::exception &e) {
+        std::cerr << "Failed to restore after bulk load: " << e.what();
+      }
+    }
+
+    void finish() {
+      if (finished_) {
+        return;
+      }
+      finished_ = true;
+      {
+        SafeSQLite::Transaction transaction(*owner_.db_);
+        for (const auto &index : owner_.indexes_) {
+          owner_.exec_(index.second);
+        }
+        transaction.commit();
+      }
+      owner_.exec_("PRAGMA synchronous=" + synchronous_ +
+                   ";PRAGMA cache_size=" + cache_size_ + ";");
+    }
+
+  private:
+    ProtoDBConvertor &owner_;
+    std::string synchronous_;
+    std::string cache_size_;
+    bool finished_ = false;
+  };
+
+  std::string pragma_(const std::string &name) {
+    CachedStatement stmt(db_->statements(), "PRAGMA " + name + ";");
+    std::string value;
+    if (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+      value = (const char *)sqlite3_column_text(stmt.get(), 0);
+    }
+    return value;
+  }
+
+  void exec_(const std::string &sql) {
+    char *errmsg = nullptr;
+    if (sqlite3_exec(db_->get(), sql.c_str(), nullptr, nullptr, &errmsg) !=
+        SQLITE_OK) {
+      std::string error = errmsg ? errmsg : sqlite3_errmsg(db_->get());
+      sqlite3_free(errmsg);
+      throw std::runtime_error("Failed to execute " + sql + ": " + error);
+    }
+  }
+
+  const ColumnPlan &blob_column_(const std::string &name) const {
+    const ColumnPlan &column = find_column_(name);
+    if (primary_key_.empty() || column.field->is_repeated() ||
+        column.field->cpp_type() !=
+            google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+      throw std::runtime_error("Cannot stream " + name + " of " +
+                               table_name_);
+    }
+    return column;
+  }
+
+  template <typename K>
+  BlobHandle open_blob_(sqlite3 *db, StatementCache &statements,
+                        const ColumnPlan &column, const K &key, int flags) {
+    sqlite3_int64 rowid;
+    {
+      CachedStatement stmt(statements, "select rowid from " + table_name_ +
+                                           " where " + primary_key_ + " = ?");
+      bind_values(stmt.get(), column_argument(*primary_column_.field, key));
+      if (sqlite3_step(stmt.get()) != SQLITE_ROW) {
+        throw std::runtime_error("No row in " + table_name_ +
+                                 " with that key");
+      }
+      rowid = sqlite3_column_int64(stmt.get(), 0);
+    }
+    sqlite3_blob *blob = nullptr;
+    if (sqlite3_blob_open(db, "main", table_name_.c_str(),
+                          column.name.c_str(), rowid, flags,
+                          &blob) != SQLITE_OK) {
+      std::string error = sqlite3_errmsg(db);
+      sqlite3_blob_close(blob);
+      throw std::runtime_error("Failed to open blob " + column.name + ": " +
+                               error);
+    }
+    return BlobHandle(blob);
+  }
+
+  static void check_chunk_size_(size_t chunk_size) {
+    if (chunk_size == 0) {
+      throw std::runtime_error("Blob chunk size must be positive");
+    }
+  }
+
+  const ColumnPlan &find_column_(const std::string &name) const {
+    for (const auto &column : columns_) {
+      if (column.name == name && !column.packed) {
+        return column;
+      }
+    }
+    throw std::runtime_error("Unknown column " + name + " in " + table_name_);
+  }
+
+  bool stores_(const google::protobuf::FieldDescriptor *field) const {
+    for (const auto &column : columns_) {
+      if (column.field == field) {
+        return true;
+      }
+    }
+    for (const auto &child : children_) {
+      if (child.field == field) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool update_(const T &obj,
+               const std::vector<const google::protobuf::FieldDescriptor *>
+                   &fields) {
+    if (primary_key_.empty()) {
+      throw std::runtime_error("Cannot update " + table_name_ +
+                               " without a primary key");
+    }
+
+    std::vector<const ColumnPlan *> columns;
+    std::vector<ChildTable *> children;
+    for (const auto *field : fields) {
+      if (field == primary_column_.field) {
+        continue;
+      }
+      for (const auto &column : columns_) {
+        if (column.field == field) {
+          columns.push_back(&column);
+        }
+      }
+      for (auto &child : children_) {
+        if (child.field == field) {
+          children.push_back(&child);
+        }
+      }
+    }
+    auto lock = db_->lock();
+    if (columns.empty() && children.empty()) {
+      return row_exists_(obj);
+    }
+
+    bool updated;
+    if (children.empty()) {
+      updated = update_row_(obj, columns);
+    } else {
+      SafeSQLite::Transaction transaction(*db_);
+      updated = update_row_(obj, columns);
+      if (updated) {
+        for (auto *child : children) {
+          write_children_(*child, obj);
+        }
+      }
+      transaction.commit();
+    }
+    if (updated && cache_) {
+      cache_->erase(key_text(obj, primary_column_.field));
+    }
+    return updated;
+  }
+
+  bool row_exists_(const T &obj) {
+    CachedStatement stmt(db_->statements(), "select 1 from " + table_name_ +
+                                                " where " + primary_key_ +
+                                                " = ?");
+    bind_column_(stmt.get(), 1, primary_column_, obj);
+    int rc = sqlite3_step(stmt.get());
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+      throw std::runtime_error("Error querying database: " +
+                               std::string(sqlite3_errmsg(db_->get())));
+    }
+    return rc == SQLITE_ROW;
+  }
+
+  bool update_row_(const T &obj,
+                   const std::vector<const ColumnPlan *> &columns) {
+    // the statement text depends only on the column set, so each distinct
+    // mask is prepared once and then reused from the statement cache
+    std::string sql = "UPDATE " + table_name_ + " SET ";
+    for (const auto *column : columns) {
+      sql += column->name + "=?,";
+    }
+    if (columns.empty()) {
+      sql += primary_key_ + "=" + primary_key_ + " ";
+    } else {
+      sql.back() = ' ';
+    }
+    sql += "WHERE " + primary_key_ + " = ?;";
+
+    CachedStatement stmt(db_->statements(), sql);
+    {
+      ScopedLatency timer(metrics_.bind);
+      int index = 1;
+      for (const auto *column : columns) {
+        bind_column_(stmt.get(), index++, *column, obj);
+      }
+      bind_column_(stmt.get(), index, primary_column_, obj);
+    }
+    step_(stmt.get(), obj);
+    if (sqlite3_changes(db_->get()) == 0) {
+      return false;
+    }
+    metrics_.rows_written.add();
+    return true;
+  }
+
+  ChildTable make_child_table_(const google::protobuf::FieldDescriptor &field,
+                               const ConvertorOptions &options) {
+    ChildTable child;
+    child.field = &field;
+    child.table_name = table_name_ + "_" + field.name();
+    child.scan_sql =
+        "select * from " + child.table_name + " order by _parent,_ordinal";
+    child.lookup_sql = "select * from " + child.table_name +
+                       " where _parent = ? order by _ordinal";
+    const google::protobuf::Descriptor *descriptor = field.message_type();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+      const auto &member = *descriptor->field(i);
+      std::string member_name = field.name() + "." + member.name();
+      if (options.skip_names.find(member_name) != options.skip_names.end()) {
+        continue;
+      }
+      if (member.is_repeated() &&
+          member.cpp_type() ==
+              google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE) {
+        throw std::runtime_error("Nested repeated message field: " +
+                                 member_name);
+      }
+      child.columns.push_back(make_column_plan(
+          member, (int)child.columns.size() + 1 + ChildTable::key_columns,
+          options.pack_repeated));
+    }
+    return child;
+  }
+
+  template <typename... Args>
+  Cursor open_cursor_(const std::string &sql, ChildMode mode,
+                      const Args &...args) {
+    return open_cursor_(db_->reader(), sql, mode, args...);
+  }
+
+  // A merging cursor over anything but the whole table reads each child
+  // table restricted to the parents sql selects. Rows without their primary
+  // key cannot be matched to children, so those are left empty.
+  template <typename... Args>
+  Cursor open_cursor_(SafeSQLite::Reader reader, const std::string &sql,
+                      ChildMode mode, const Args &...args) {
+    CachedStatement stmt(reader.statements(), sql);
+    bind_values(stmt.get(), args...);
+    if (children_.empty() || !selects_key_(stmt.get())) {
+      mode = ChildMode::None;
+    }
+    std::vector<CachedStatement> merged;
+    if (mode == ChildMode::Merge &&
+        sql != select_all_sql_ + " order by " + primary_key_) {
+      for (const auto &child : children_) {
+        merged.emplace_back(reader.statements(), children_sql_(child, sql));
+        bind_values(merged.back().get(), args...);
+      }
+    }
+    return Cursor(*this, std::move(reader), std::move(stmt), mode,
+                  std::move(merged));
+  }
+
+  bool selects_key_(sqlite3_stmt *stmt) const {
+    if (primary_key_.empty()) {
+      return false;
+    }
+    for (int i = 0; i < sqlite3_column_count(stmt); ++i) {
+      if (primary_key_ == sqlite3_column_name(stmt, i)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  ChildMode child_mode_(const std::string &sql) const {
+    if (children_.empty()) {
+      return ChildMode::None;
+    }
+    return ordered_by_key_(sql) ? ChildMode::Merge : ChildMode::Lookup;
+  }
+
+  // Whether the rows of sql come in ascending primary key order: its last
+  // ORDER BY names the primary key alone and only a LIMIT may follow.
+  bool ordered_by_key_(const std::string &sql) const {
+    std::vector<std::string> words(1);
+    for (char c : sql) {
+      if (std::isspace((unsigned char)c) || c == ';') {
+        if (!words.back().empty()) {
+          words.emplace_back();
+        }
+      } else {
+        words.back() += (char)std::tolower((unsigned char)c);
+      }
+    }
+    if (words.back().empty()) {
+      words.pop_back();
+    }
+    size_t i = words.size();
+    while (i >= 2 && !(words[i - 2] == "order" && words[i - 1] == "by")) {
+      --i;
+    }
+    if (i < 2 || i == words.size()) {
+      return false;
+    }
+    std::string key = primary_key_;
+    std::transform(key.begin(), key.end(), key.begin(),
+                   [](unsigned char c) { return (char)std::tolower(c); });
+    if (words[i++] != key) {
+      return false;
+    }
+    if (i < words.size() && words[i] == "asc") {
+      ++i;
+    }
+    if (i == words.size()) {
+      return true;
+    }
+    if (words[i] != "limit") {
+      return false;
+    }
+    return std::none_of(words.begin() + i, words.end(),
+                        [](const std::string &word) {
+                          return word.find_first_of("()") != std::string::npos;
+                        });
+  }
+
+  // The rows of child belonging to the parents selected by sql, in
+  // (_parent, _ordinal) order; binds the same arguments as sql.
+  std::string children_sql_(const ChildTable &child, std::string sql) const {
+    while (!sql.empty() &&
+           (sql.back() == ';' || std::isspace((unsigned char)sql.back()))) {
+      sql.pop_back();
+    }
+    return "select * from " + child.table_name + " where _parent in (select " +
+           primary_key_ + " from (" + sql + ")) order by _parent,_ordinal";
+  }
+
+  // One read transaction around queries that must agree with each other.
+  // On the writer connection it holds the writer lock, and inside a
+  // caller's transaction it reuses that one. A pooled reader still inside
+  // the snapshot ends it when returned to the pool.
+  class ReadSnapshot {
+  public:
+    ReadSnapshot(SafeSQLite &db, sqlite3 *connection, bool active)
+        : connection_(connection), on_writer_(connection == db.get()) {
+      if (!active) {
+        return;
+      }
+      if (on_writer_) {
+        lock_ = db.lock();
+      }
+      if (sqlite3_get_autocommit(connection_)) {
+        if (sqlite3_exec(connection_, "BEGIN", nullptr, nullptr, nullptr) !=
+            SQLITE_OK) {
+          throw std::runtime_error("Failed to begin snapshot: " +
+                                   std::string(sqlite3_errmsg(connection_)));
+        }
+        began_ = true;
+      }
+    }
+
+    ReadSnapshot(const ReadSnapshot &) = delete;
+    ReadSnapshot &operator=(const ReadSnapshot &) = delete;
+
+    ~ReadSnapshot() {
+      if (began_ && on_writer_) {
+        sqlite3_exec(connection_, "ROLLBACK", nullptr, nullptr, nullptr);
+      }
+    }
+
+    void end() {
+      if (began_) {
+        began_ = false;
+        if (sqlite3_exec(connection_, "COMMIT", nullptr, nullptr, nullptr) !=
+            SQLITE_OK) {
+          throw std::runtime_error("Failed to end snapshot: " +
+                                   std::string(sqlite3_errmsg(connection_)));
+        }
+      }
+    }
+
+  private:
+    sqlite3 *connection_;
+    bool on_writer_;
+    bool began_ = false;
+    std::unique_lock<std::recursive_mutex> lock_;
+  };
+
+  // Partitions are rowid ranges. With child tables each partition is read
+  // in primary key order so they merge in.
+  template <typename F> void parallel_scan_(size_t threads, F worker) {
+    ChildMode mode = children_.empty() ? ChildMode::None : ChildMode::Merge;
+    std::string order =
+        children_.empty() ? " order by rowid" : " order by " + primary_key_;
+    if (threads == 0) {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::string &filename = db_->filename();
+    if (threads == 1 || filename.empty() || filename == ":memory:") {
+      Cursor rows = open_cursor_(select_all_sql_ + order, mode);
+      worker(0, rows);
+      return;
+    }
+
+    sqlite3_int64 first = 0;
+    sqlite3_int64 last = -1;
+    {
+      SafeSQLite::Reader reader = db_->reader();
+      CachedStatement bounds(reader.statements(),
+                             "select min(rowid), max(rowid) from " +
+                                 table_name_);
+      if (sqlite3_step(bounds.get()) == SQLITE_ROW &&
+          sqlite3_column_type(bounds.get(), 0) != SQLITE_NULL) {
+        first = sqlite3_column_int64(bounds.get(), 0);
+        last = sqlite3_column_int64(bounds.get(), 1);
+      }
+    }
+    if (last < first) {
+      return;
+    }
+    uint64_t span = (uint64_t)(last - first) + 1;
+    threads = (size_t)std::min<uint64_t>(threads, span);
+    uint64_t step = span / threads;
+
+    std::string sql = select_all_sql_ + " where rowid >= ? and rowid <= ?" +
+                      order;
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(threads);
+    for (size_t i = 0; i < threads; ++i) {
+      sqlite3_int64 lo = first + (sqlite3_int64)(step * i);
+      sqlite3_int64 hi =
+          i + 1 == threads ? last : lo + (sqlite3_int64)step - 1;
+      workers.emplace_back([&, i, lo, hi] {
+        try {
+          Cursor rows = open_cursor_(db_->open_reader(), sql, mode, lo, hi);
+          worker(i, rows);
+        } catch (...) {
+          errors[i] = std::current_exception();
+        }
+      });
+    }
+    for (auto &thread : workers) {
+      thread.join();
+    }
+    for (const auto &error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+  template <typename... Args>
+  size_t export_(const std::string &path, bool snapshot,
+                 const std::string &sql, ChildMode mode,
+                 const Args &...args) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      throw std::runtime_error("Failed to open " + path);
+    }
+    google::protobuf::io::FileOutputStream output(fd);
+    size_t count;
+    try {
+      count = export_rows_(&output, snapshot, sql, mode, args...);
+    } catch (...) {
+      output.Close();
+      throw;
+    }
+    if (!output.Close()) {
+      throw std::runtime_error("Failed to write " + path);
+    }
+    return count;
+  }
+
+  template <typename... Args>
+  size_t export_rows_(google::protobuf::io::ZeroCopyOutputStream *output,
+                      bool snapshot, const std::string &sql, ChildMode mode,
+                      const Args &...args) {
+    SafeSQLite::Reader reader = db_->reader();
+    ReadSnapshot read_snapshot(*db_, reader.get(), snapshot);
+    Cursor rows = open_cursor_(std::move(reader), sql, mode, args...);
+    google::protobuf::io::CodedOutputStream coded(output);
+    size_t count = 0;
+    while (rows.next()) {
+      const T &row = rows.value();
+      coded.WriteVarint32((uint32_t)row.ByteSizeLong());
+      row.SerializeWithCachedSizes(&coded);
+      ++count;
+    }
+    coded.Trim();
+    if (coded.HadError()) {
+      throw std::runtime_error("Failed to write exported rows");
+    }
+    read_snapshot.end();
+    return count;
+  }
+
+  template <typename F> static size_t visit_(Cursor rows, F &fn) {
+    size_t count = 0;
+    while (rows.next()) {
+      ++count;
+      if constexpr (std::is_same_v<std::invoke_result_t<F &, T &>, bool>) {
+        if (!fn(rows.value())) {
+          break;
+        }
+      } else {
+        fn(rows.value());
+      }
+    }
+    return count;
+  }
+
+  template <typename... Args>
+  void read_children_(const SafeSQLite::Reader &reader, const std::string &sql,
+                      const std::vector<T *> &parents, const Args &...args) {
+    std::unordered_map<std::string, T *> by_key;
+    by_key.reserve(parents.size());
+    for (T *parent : parents) {
+      by_key.emplace(key_text(*parent, primary_column_.field), parent);
+    }
+    for (const auto &child : children_) {
+      CachedStatement stmt(reader.statements(), children_sql_(child, sql));
+      bind_values(stmt.get(), args...);
+      auto layout = resolve_layout(stmt.get(), child.columns,
+                                   child.field->message_type(),
+                                   ChildTable::key_columns);
+      std::string key;
+      T *parent = nullptr;
+      bool first = true;
+      int rc;
+      while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+        std::string_view row_key(
+            reinterpret_cast<const char *>(sqlite3_column_text(stmt.get(), 0)),
+            sqlite3_column_bytes(stmt.get(), 0));
+        if (first || row_key != key) {
+          first = false;
+          key.assign(row_key);
+          auto it = by_key.find(key);
+          parent = it == by_key.end() ? nullptr : it->second;
+        }
+        if (parent != nullptr) {
+          decode_row(stmt.get(), layout,
+                     parent->GetReflection()->AddMessage(parent, child.field),
+                     ChildTable::key_columns);
+        }
+      }
+      if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Error querying database: " +
+                                 std::string(sqlite3_errmsg(reader.get())));
+      }
+    }
   }
 
-private:
   sqlite3_stmt *insert_stmt_ = nullptr;
+  // the upsert write_ uses instead of REPLACE while the change feed records
+  sqlite3_stmt *upsert_stmt_ = nullptr;
   sqlite3_stmt *delete_stmt_ = nullptr;
   std::string table_name_;
+  std::string select_all_sql_;
   std::string primary_key_;
-  std::vector<std::string> member_names_;
+  std::vector<ColumnPlan> columns_;
+  ColumnPlan primary_column_;
+  std::vector<ChildTable> children_;
+  // index name and its CREATE INDEX statement
+  std::vector<std::pair<std::string, std::string>> indexes_;
+  // write_ and full-row cursors go through ProtoDBCodec<T>
+  bool codec_rows_ = false;
+  void (*codec_bind_)(sqlite3_stmt *, const T &) = nullptr;
+  void (*codec_decode_)(sqlite3_stmt *, T *) = nullptr;
+  std::unique_ptr<RowCache<T>> cache_;
+  bool cache_writes_ = false;
+  mutable ConvertorMetrics metrics_;
   std::shared_ptr<SafeSQLite> db_;
+  size_t batch_size_ = 1000;
 };
 
 }
@@ -0,0 +1,189 @@
+// =================================
+// Created by Lipson on 24-4-1.
+// Email to LipsonChan@yahoo.com
+// Copyright (c) 2024 Lipson. All rights reserved.
+// Version 1.0
+// =================================
+
+#ifndef PROTODB_PROTO_DB_METRICS_HPP
+#define PROTODB_PROTO_DB_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Define PROTODB_METRICS to collect counters and latency histograms. Without
+// it every type below is an empty stub and all recording compiles away.
+
+namespace proto_mapper {
+
+struct LatencySnapshot {
+  static constexpr size_t bucket_count = 40;
+
+  uint64_t count = 0;
+  uint64_t total_ns = 0;
+  uint64_t max_ns = 0;
+  // buckets[i] counts samples in [2^(i-1), 2^i) ns, buckets[0] the zeros
+  std::array<uint64_t, bucket_count> buckets{};
+
+  double mean_ns() const { return count == 0 ? 0 : (double)total_ns / count; }
+
+  // Upper bound of the bucket holding the p-th percentile, p in [0, 1].
+  uint64_t percentile_ns(double p) const {
+    uint64_t rank = (uint64_t)(p * count);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+      seen += buckets[i];
+      if (seen > rank) {
+        return i == 0 ? 0 : (uint64_t)1 << i;
+      }
+    }
+    return max_ns;
+  }
+};
+
+struct ConvertorMetricsSnapshot {
+  uint64_t rows_written = 0;
+  uint64_t rows_read = 0;
+  uint64_t rows_deleted = 0;
+  LatencySnapshot bind;
+  LatencySnapshot step;
+  LatencySnapshot decode;
+};
+
+struct ConnectionMetricsSnapshot {
+  uint64_t statement_cache_hits = 0;
+  uint64_t statement_cache_misses = 0;
+  LatencySnapshot lock_wait;
+  LatencySnapshot reader_wait;
+};
+
+#ifdef PROTODB_METRICS
+
+inline constexpr bool metrics_enabled = true;
+
+class LatencyHistogram {
+public:
+  void record(uint64_t ns) {
+    size_t bucket = 0;
+    while (bucket + 1 < LatencySnapshot::bucket_count &&
+           ns >= ((uint64_t)1 << bucket)) {
+      ++bucket;
+    }
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t max = max_.load(std::memory_order_relaxed);
+    while (ns > max &&
+           !max_.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+    }
+  }
+
+  LatencySnapshot snapshot() const {
+    LatencySnapshot snapshot;
+    snapshot.count = count_.load(std::memory_order_relaxed);
+    snapshot.total_ns = total_.load(std::memory_order_relaxed);
+    snapshot.max_ns = max_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < LatencySnapshot::bucket_count; ++i) {
+      snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, LatencySnapshot::bucket_count> buckets_{};
+  std::atomic<uint64_t> count_{0};
+  std::atomic<uint64_t> total_{0};
+  std::atomic<uint64_t> max_{0};
+};
+
+class MetricCounter {
+public:
+  void add(uint64_t value = 1) {
+    value_.fetch_add(value, std::memory_order_relaxed);
+  }
+  uint64_t get() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint64_t> value_{0};
+};
+
+// Records the lifetime of the scope into a histogram.
+class ScopedLatency {
+public:
+  explicit ScopedLatency(LatencyHistogram &histogram)
+      : histogram_(histogram), begin_(std::chrono::steady_clock::now()) {}
+
+  ~ScopedLatency() {
+    histogram_.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - begin_)
+                          .count());
+  }
+
+private:
+  LatencyHistogram &histogram_;
+  std::chrono::steady_clock::time_point begin_;
+};
+
+#else
+
+inline constexpr bool metrics_enabled = false;
+
+class LatencyHistogram {
+public:
+  void record(uint64_t) {}
+  LatencySnapshot snapshot() const { return {}; }
+};
+
+class MetricCounter {
+public:
+  void add(uint64_t = 1) {}
+  uint64_t get() const { return 0; }
+};
+
+class ScopedLatency {
+public:
+  explicit ScopedLatency(LatencyHistogram &) {}
+};
+
+#endif // PROTODB_METRICS
+
+struct ConvertorMetrics {
+  MetricCounter rows_written;
+  MetricCounter rows_read;
+  MetricCounter rows_deleted;
+  LatencyHistogram bind;
+  LatencyHistogram step;
+  LatencyHistogram decode;
+
+  ConvertorMetricsSnapshot snapshot() const {
+    ConvertorMetricsSnapshot snapshot;
+    snapshot.rows_written = rows_written.get();
+    snapshot.rows_read = rows_read.get();
+    snapshot.rows_deleted = rows_deleted.get();
+    snapshot.bind = bind.snapshot();
+    snapshot.step = step.snapshot();
+    snapshot.decode = decode.snapshot();
+    return snapshot;
+  }
+};
+
+struct ConnectionMetrics {
+  MetricCounter statement_cache_hits;
+  MetricCounter statement_cache_misses;
+  LatencyHistogram lock_wait;
+  LatencyHistogram reader_wait;
+
+  ConnectionMetricsSnapshot snapshot() const {
+    ConnectionMetricsSnapshot snapshot;
+    snapshot.statement_cache_hits = statement_cache_hits.get();
+    snapshot.statement_cache_misses = statement_cache_misses.get();
+    snapshot.lock_wait = lock_wait.snapshot();
+    snapshot.reader_wait = reader_wait.snapshot();
+    return snapshot;
+  }
+};
+
+} // namespace proto_mapper
+#endif // PROTODB_PROTO_DB_METRICS_HPP
@@ -0,0 +1,385 @@
+// =================================
+// Created by Lipson on 24-4-1.
+// Email to LipsonChan@yahoo.com
+// Copyright (c) 2024 Lipson. All rights reserved.
+// Version 1.0
+// =================================
+
+#ifndef PROTODB_PROTO_DB_SHARDED_HPP
+#define PROTODB_PROTO_DB_SHARDED_HPP
+
+#include "proto_db_convertor.hpp"
+#include <cstdio>
+#include <queue>
+
+namespace proto_mapper {
+
+// 64-bit FNV-1a, the shard hash of a primary key's text.
+inline uint64_t fnv1a(std::string_view data) {
+  uint64_t hash = 14695981039346656037ull;
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+inline std::string shard_path(const std::string &path, size_t index) {
+  return path + ".shard" + std::to_string(index);
+}
+
+// A table spread over shard_count database files <path>.shard<i>, each
+// with its own SafeSQLite (connection, lock, statement cache) and
+// convertor, so writes to different shards run in parallel. A row lives in
+// shard fnv1a(primary key text) % shard_count. Every file records the
+// shard count in a protodb_shards table; use reshard() to change it.
+template <typename T, bool BindF(sqlite3_stmt *, int, const std::string &,
+                                 const T &) = DEFAULT_SQLITE_BIND>
+class ShardedProtoDBConvertor {
+public:
+  using Convertor = ProtoDBConvertor<T, BindF>;
+
+  // shard_count 0 opens an existing set with the count it was created
+  // with. reader_count is the reader pool size of every shard.
+  ShardedProtoDBConvertor(const std::string &path, size_t shard_count,
+                          const ConvertorOptions &options,
+                          size_t reader_count = 0)
+      : path_(path) {
+    key_field_ = T::descriptor()->FindFieldByName(options.primary_key);
+    if (key_field_ == nullptr || !is_key_field(*key_field_)) {
+      throw std::runtime_error("Sharding " + T::descriptor()->name() +
+                               " needs an integer or string primary key");
+    }
+    if (shard_count == 0) {
+      shard_count = stored_shard_count(path);
+      if (shard_count == 0) {
+        throw std::runtime_error("No shards at " + path);
+      }
+    }
+    for (size_t i = 0; i < shard_count; ++i) {
+      auto db = std::make_shared<SafeSQLite>(shard_path(path, i),
+                                             reader_count);
+      check_shard_(*db, i, shard_count);
+      shards_.push_back(std::make_unique<Convertor>(db, options));
+    }
+  }
+
+  ShardedProtoDBConvertor(const ShardedProtoDBConvertor &) = delete;
+  ShardedProtoDBConvertor &operator=(const ShardedProtoDBConvertor &) =
+      delete;
+
+  // The count recorded in <path>.shard0, 0 when there is no such set.
+  static size_t stored_shard_count(const std::string &path) {
+    struct stat info;
+    if (::stat(shard_path(path, 0).c_str(), &info) != 0) {
+      return 0;
+    }
+    SafeSQLite db(shard_path(path, 0));
+    auto lock = db.lock();
+    sqlite3_stmt *stmt = nullptr;
+    size_t count = 0;
+    if (sqlite3_prepare_v2(db.get(), "select shard_count from protodb_shards",
+                           -1, &stmt, nullptr) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+      count = (size_t)sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return count;
+  }
+
+  size_t shard_count() const { return shards_.size(); }
+  Convertor &shard(size_t index) { return *shards_[index]; }
+
+  size_t shard_of(const T &obj) const {
+    return fnv1a(key_text(obj, key_field_)) % shards_.size();
+  }
+
+  template <typename K> size_t shard_of_key(const K &key) const {
+    return fnv1a(key_argument_text(column_argument(*key_field_, key))) %
+           shards_.size();
+  }
+
+  void write(const T &obj) { shards_[shard_of(obj)]->write(obj); }
+
+  // Splits obj by shard and writes the parts concurrently, each committed
+  // in chunks of the shard's batch_size() like ProtoDBConvertor::write. A
+  // failure in one shard does not undo the others.
+  void write(const std::vector<T> &obj) {
+    std::vector<std::vector<const T *>> parts(shards_.size());
+    for (const auto &row : obj) {
+      parts[shard_of(row)].push_back(&row);
+    }
+    each_shard_([&](size_t i) {
+      Convertor &shard = *shards_[i];
+      const std::vector<const T *> &rows = parts[i];
+      size_t chunk = shard.batch_size() == 0 ? rows.size() : shard.batch_size();
+      for (size_t begin = 0; begin < rows.size(); begin += chunk) {
+        SafeSQLite::Transaction transaction(*shard.db());
+        size_t end = std::min(rows.size(), begin + chunk);
+        for (size_t j = begin; j < end; ++j) {
+          shard.write(*rows[j]);
+        }
+        transaction.commit();
+      }
+    });
+  }
+
+  bool update(const T &obj, const google::protobuf::FieldMask &mask) {
+    return shards_[shard_of(obj)]->update(obj, mask);
+  }
+
+  bool update(const T &obj) { return shards_[shard_of(obj)]->update(obj); }
+
+  void delete_obj(const T &obj) { shards_[shard_of(obj)]->delete_obj(obj); }
+
+  template <typename K> std::optional<T> get(const K &key) {
+    return shards_[shard_of_key(key)]->get(key);
+  }
+
+  // Every row, read from all shards concurrently and merged in primary
+  // key order.
+  std::vector<T> read() {
+    std::string sql = "select * from " + T::descriptor()->name() +
+                      " order by " + key_field_->name();
+    std::vector<std::vector<T>> parts = fan_out_(sql);
+    return merge_(parts);
+  }
+
+  // Runs sql on every shard concurrently and concatenates the results in
+  // shard order; an ORDER BY or LIMIT applies per shard.
+  template <typename... Args>
+  std::vector<T> read(const std::string &sql, const Args &...args) {
+    std::vector<std::vector<T>> parts = fan_out_(sql, args...);
+    std::vector<T> result;
+    for (auto &part : parts) {
+      std::move(part.begin(), part.end(), std::back_inserter(result));
+    }
+    return result;
+  }
+
+  // Calls fn(T &) for every row, one shard after the other. Returns the
+  // number of rows visited.
+  template <typename F> size_t for_each(F &&fn) {
+    size_t count = 0;
+    for (auto &shard : shards_) {
+      count += shard->for_each(fn);
+    }
+    return count;
+  }
+
+  // Calls fn(T &) from one thread per shard; fn must be thread safe.
+  template <typename F> size_t parallel_for_each(F &&fn) {
+    std::vector<size_t> counts(shards_.size());
+    each_shard_([&](size_t i) { counts[i] = shards_[i]->for_each(fn); });
+    size_t count = 0;
+    for (size_t shard_rows : counts) {
+      count += shard_rows;
+    }
+    return count;
+  }
+
+private:
+  static void check_shard_(SafeSQLite &db, size_t index, size_t count) {
+    auto lock = db.lock();
+    char *errmsg = nullptr;
+    if (sqlite3_exec(db.get(),
+                     "CREATE TABLE IF NOT EXISTS protodb_shards "
+                     "(shard_count INTEGER NOT NULL, "
+                     "shard_index INTEGER NOT NULL);",
+                     nullptr, nullptr, &errmsg) != SQLITE_OK) {
+      std::string error = errmsg ? errmsg : sqlite3_errmsg(db.get());
+      sqlite3_free(errmsg);
+      throw std::runtime_error("Failed to open shard " + db.filename() +
+                               ": " + error);
+    }
+    CachedStatement select(db.statements(),
+                           "select shard_count, shard_index from "
+                           "protodb_shards");
+    if (sqlite3_step(select.get()) == SQLITE_ROW) {
+      auto stored_count = (size_t)sqlite3_column_int64(select.get(), 0);
+      auto stored_index = (size_t)sqlite3_column_int64(select.get(), 1);
+      if (stored_count != count || stored_index != index) {
+        throw std::runtime_error(
+            db.filename() + " is shard " + std::to_string(stored_index) +
+            " of " + std::to_string(stored_count) + ", not " +
+            std::to_string(index) + " of " + std::to_string(count) +
+            "; use reshard() to change the shard count");
+      }
+      return;
+    }
+    CachedStatement insert(db.statements(),
+                           "INSERT INTO protodb_shards (shard_count, "
+                           "shard_index) VALUES (?, ?);");
+    bind_values(insert.get(), (sqlite3_int64)count, (sqlite3_int64)index);
+    if (sqlite3_step(insert.get()) != SQLITE_DONE) {
+      throw std::runtime_error("Failed to record shard in " + db.filename() +
+                               ": " + sqlite3_errmsg(db.get()));
+    }
+  }
+
+  // Runs fn(i) for every shard, one thread each, and rethrows the first
+  // failure once all of them finished.
+  template <typename F> void each_shard_(F fn) {
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(shards_.size());
+    for (size_t i = 0; i < shards_.size(); ++i) {
+      workers.emplace_back([&, i] {
+        try {
+          fn(i);
+        } catch (...) {
+          errors[i] = std::current_exception();
+        }
+      });
+    }
+    for (auto &thread : workers) {
+      thread.join();
+    }
+    for (const auto &error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+  template <typename... Args>
+  std::vector<std::vector<T>> fan_out_(const std::string &sql,
+                                       const Args &...args) {
+    std::vector<std::vector<T>> parts(shards_.size());
+    each_shard_([&](size_t i) { parts[i] = shards_[i]->read(sql, args...); });
+    return parts;
+  }
+
+  bool key_less_(const T &left, const T &right) const {
+    if (key_field_->cpp_type() ==
+        google::protobuf::FieldDescriptor::CPPTYPE_STRING) {
+      return left.GetReflection()->GetString(left, key_field_) <
+             right.GetReflection()->GetString(right, key_field_);
+    }
+    return key_integer(left, key_field_) < key_integer(right, key_field_);
+  }
+
+  // k-way merge of the per-shard results, each already in key order.
+  std::vector<T> merge_(std::vector<std::vector<T>> &parts) {
+    // (shard, position) pairs, the smallest key on top
+    auto greater = [&](const std::pair<size_t, size_t> &a,
+                       const std::pair<size_t, size_t> &b) {
+      return key_less_(parts[b.first][b.second], parts[a.first][a.second]);
+    };
+    std::priority_queue<std::pair<size_t, size_t>,
+                        std::vector<std::pair<size_t, size_t>>,
+                        decltype(greater)>
+        heads(greater);
+    size_t total = 0;
+    for (size_t i = 0; i < parts.size(); ++i) {
+      total += parts[i].size();
+      if (!parts[i].empty()) {
+        heads.emplace(i, 0);
+      }
+    }
+    std::vector<T> result;
+    result.reserve(total);
+    while (!heads.empty()) {
+      auto [shard, position] = heads.top();
+      heads.pop();
+      result.push_back(std::move(parts[shard][position]));
+      if (position + 1 < parts[shard].size()) {
+        heads.emplace(shard, position + 1);
+      }
+    }
+    return result;
+  }
+
+  std::string path_;
+  const google::protobuf::FieldDescriptor *key_field_ = nullptr;
+  std::vector<std::unique_ptr<Convertor>> shards_;
+};
+
+// Offline: moves every row of the shard set at path into a new set of
+// shard_count files and replaces the old files with it. No other process
+// may have the set open. Returns the number of rows moved.
+//
+// The new set is built at <path>.reshard, the old one renamed to
+// <path>.old, and only deleted once the new set is in place. A failed swap
+// restores the old set; if the process dies during it, the old set is
+// still complete at <path>.old.
+template <typename T, bool BindF(sqlite3_stmt *, int, const std::string &,
+                                 const T &) = DEFAULT_SQLITE_BIND>
+size_t reshard(const std::string &path, size_t shard_count,
+               ConvertorOptions options, size_t batch_rows = 10000) {
+  using Sharded = ShardedProtoDBConvertor<T, BindF>;
+  size_t old_count = Sharded::stored_shard_count(path);
+  if (old_count == 0) {
+    throw std::runtime_error("No shards at " + path);
+  }
+  if (shard_count == 0) {
+    throw std::runtime_error("Cannot reshard " + path + " into 0 shards");
+  }
+  auto remove_set = [](const std::string &base, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      for (const char *suffix : {"", "-wal", "-shm", "-journal"}) {
+        std::remove((shard_path(base, i) + suffix).c_str());
+      }
+    }
+  };
+  // Renames a closed set; on failure renames the files moved so far back.
+  auto move_set = [](const std::string &from, const std::string &to,
+                     size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      if (std::rename(shard_path(from, i).c_str(),
+                      shard_path(to, i).c_str()) != 0) {
+        while (i-- > 0) {
+          std::rename(shard_path(to, i).c_str(), shard_path(from, i).c_str());
+        }
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::string retired = path + ".old";
+  if (Sharded::stored_shard_count(retired) != 0) {
+    throw std::runtime_error("An earlier reshard left " + retired +
+                             "; restore or delete it first");
+  }
+  std::string staging = path + ".reshard";
+  remove_set(staging, shard_count);
+  size_t moved = 0;
+  {
+    ConvertorOptions source_options = options;
+    source_options.need_create_table = false;
+    source_options.cache_bytes = 0;
+    Sharded source(path, old_count, source_options);
+    options.need_create_table = true;
+    Sharded target(staging, shard_count, options);
+    std::vector<T> batch;
+    batch.reserve(batch_rows);
+    source.for_each([&](T &row) {
+      batch.push_back(std::move(row));
+      if (batch.size() >= batch_rows) {
+        target.write(batch);
+        moved += batch.size();
+        batch.clear();
+      }
+    });
+    target.write(batch);
+    moved += batch.size();
+  }
+
+  if (!move_set(path, retired, old_count)) {
+    throw std::runtime_error("Failed to move " + path + " aside to " +
+                             retired + "; the old set is unchanged");
+  }
+  if (!move_set(staging, path, shard_count)) {
+    if (!move_set(retired, path, old_count)) {
+      throw std::runtime_error("Failed to install the new set; the old set "
+                               "is at " + retired);
+    }
+    throw std::runtime_error("Failed to install the new set; the old set "
+                             "was restored, the new one is at " + staging);
+  }
+  remove_set(retired, old_count);
+  return moved;
+}
+
+} // namespace proto_mapper
+#endif // PROTODB_PROTO_DB_SHARDED_HPP
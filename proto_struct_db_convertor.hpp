@@ -0,0 +1,424 @@
+// =================================
+// Created by Lipson on 24-4-1.
+// Email to LipsonChan@yahoo.com
+// Copyright (c) 2024 Lipson. All rights reserved.
+// Version 1.0
+// =================================
+
+#ifndef PROTODB_PROTO_STRUCT_DB_CONVERTOR_HPP
+#define PROTODB_PROTO_STRUCT_DB_CONVERTOR_HPP
+
+#include "proto_c_mapper.hpp"
+#include "proto_db_convertor.hpp"
+#include <array>
+#include <utility>
+
+namespace proto_mapper {
+
+// Persists the plain struct of a ProtoCStructMapper without building the
+// protobuf message: every PROTO_MEMBER is bound and read straight from the
+// struct memory with the sqlite3 call picked at compile time. The table is
+// the one ProtoDBConvertor<P> uses, vectors are stored packed as with
+// ConvertorOptions::pack_repeated.
+template <typename Mapper> class ProtoStructDBConvertor {
+public:
+  using P = typename Mapper::proto_type;
+  using C = typename Mapper::struct_type;
+  using Members = typename Mapper::members;
+  static constexpr size_t member_count = std::tuple_size_v<Members>;
+
+  explicit ProtoStructDBConvertor(const std::shared_ptr<SafeSQLite> &db,
+                                  const std::string &primary_key = "",
+                                  bool need_create_table = false)
+      : primary_key_(primary_key), db_(db) {
+    static_assert(member_count > 0, "Mapper has no PROTO_MEMBER");
+    auto lock = db_->lock();
+
+    table_name_ = P::descriptor()->name();
+    check_members_(std::make_index_sequence<member_count>());
+    const auto names = member_names_(std::make_index_sequence<member_count>());
+    for (size_t i = 0; i < member_count; ++i) {
+      column_list_ += std::string(names[i]) + ",";
+      if (primary_key_ == names[i]) {
+        primary_index_ = (int)i;
+      }
+    }
+    column_list_.pop_back();
+    if (!primary_key_.empty() && primary_index_ < 0) {
+      throw std::runtime_error("Unknown primary key: " + primary_key_);
+    }
+
+    if (need_create_table) {
+      create_table_();
+    }
+
+    std::string insert_sql =
+        (primary_key_.empty() ? "INSERT INTO " : "REPLACE INTO ") +
+        table_name_ + " (" + column_list_ + ") VALUES (";
+    for (size_t i = 0; i < member_count; ++i) {
+      insert_sql += "?,";
+    }
+    insert_sql.pop_back();
+    insert_sql += ");";
+    if (sqlite3_prepare_v2(db_->get(), insert_sql.c_str(), -1, &insert_stmt_,
+                           nullptr) != SQLITE_OK) {
+      throw std::runtime_error("Failed to prepare statement");
+    }
+
+    if (!primary_key_.empty()) {
+      auto sql =
+          "DELETE FROM " + table_name_ + " WHERE " + primary_key_ + " = ?";
+      if (sqlite3_prepare_v2(db_->get(), sql.c_str(), -1, &delete_stmt_,
+                             nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare statement");
+      }
+    }
+  }
+
+  ProtoStructDBConvertor(const ProtoStructDBConvertor &) = delete;
+  ProtoStructDBConvertor &operator=(const ProtoStructDBConvertor &) = delete;
+
+  ~ProtoStructDBConvertor() {
+    sqlite3_finalize(insert_stmt_);
+    sqlite3_finalize(delete_stmt_);
+  }
+
+  bool create_table() {
+    auto lock = db_->lock();
+    return create_table_();
+  }
+
+  void write(const C &obj) {
+    auto lock = db_->lock();
+    write_(obj);
+  }
+
+  void write(const std::vector<C> &obj) {
+    auto lock = db_->lock();
+    size_t chunk = batch_size_ == 0 ? obj.size() : batch_size_;
+    for (size_t begin = 0; begin < obj.size(); begin += chunk) {
+      SafeSQLite::Transaction transaction(*db_);
+      size_t end = std::min(obj.size(), begin + chunk);
+      for (size_t i = begin; i < end; ++i) {
+        write_(obj[i]);
+      }
+      transaction.commit();
+    }
+  }
+
+  size_t batch_size() const { return batch_size_; }
+  void set_batch_size(size_t batch_size) { batch_size_ = batch_size; }
+
+  void delete_obj(const C &obj) {
+    if (primary_key_.empty()) {
+      return;
+    }
+    auto lock = db_->lock();
+    binders_()[primary_index_](delete_stmt_, 1, obj);
+    step_(delete_stmt_);
+  }
+
+  // condition is appended to the member select, e.g. "where age > ?", and
+  // its placeholders are bound to args in order.
+  template <typename F, typename... Args>
+  size_t for_each(const std::string &condition, F &&fn, const Args &...args) {
+    SafeSQLite::Reader reader = db_->reader();
+    CachedStatement stmt(reader.statements(), "select " + column_list_ +
+                                                  " from " + table_name_ +
+                                                  " " + condition);
+    bind_values(stmt.get(), args...);
+    C obj{};
+    size_t count = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+      extract_all_(stmt.get(), obj, std::make_index_sequence<member_count>());
+      ++count;
+      if constexpr (std::is_same_v<std::invoke_result_t<F &, C &>, bool>) {
+        if (!fn(obj)) {
+          break;
+        }
+      } else {
+        fn(obj);
+      }
+    }
+    if (rc != SQLITE_DONE && rc != SQLITE_ROW) {
+      throw std::runtime_error("Error querying database: " +
+                               std::string(sqlite3_errmsg(reader.get())));
+    }
+    return count;
+  }
+
+  template <typename F> size_t for_each(F &&fn) {
+    return for_each("", std::forward<F>(fn));
+  }
+
+  template <typename... Args>
+  std::vector<C> read(const std::string &condition, const Args &...args) {
+    std::vector<C> result;
+    for_each(
+        condition, [&result](C &obj) { result.push_back(std::move(obj)); },
+        args...);
+    return result;
+  }
+
+  std::vector<C> read() { return read(""); }
+
+private:
+  using Binder = void (*)(sqlite3_stmt *, int, const C &);
+
+  template <size_t... I>
+  static std::array<const char *, member_count>
+  member_names_(std::index_sequence<I...>) {
+    return {std::tuple_element_t<I, Members>::name...};
+  }
+
+  // Whether field holds V with the same width and signedness, so a value
+  // or packed array written from the struct reads back through
+  // ProtoDBConvertor<P> unchanged.
+  template <typename V>
+  static bool same_type_(const google::protobuf::FieldDescriptor &field) {
+    using google::protobuf::FieldDescriptor;
+    switch (field.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return std::is_integral_v<V> && std::is_signed_v<V> && sizeof(V) == 4;
+    case FieldDescriptor::CPPTYPE_INT64:
+      return std::is_integral_v<V> && std::is_signed_v<V> && sizeof(V) == 8;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return std::is_integral_v<V> && std::is_unsigned_v<V> &&
+             !std::is_same_v<V, bool> && sizeof(V) == 4;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return std::is_integral_v<V> && std::is_unsigned_v<V> && sizeof(V) == 8;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      return std::is_same_v<V, float>;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      return std::is_same_v<V, double>;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return std::is_same_v<V, bool>;
+    case FieldDescriptor::CPPTYPE_STRING:
+      return std::is_same_v<V, char *> || std::is_same_v<V, std::string>;
+    default:
+      return false;
+    }
+  }
+
+  template <typename Field> static void check_member_() {
+    using V = typename Field::type;
+    static_assert(std::is_same_v<V, char *> || Field::size == sizeof(V),
+                  "PROTO_MEMBER type differs from the struct member");
+    const google::protobuf::FieldDescriptor *field =
+        P::descriptor()->FindFieldByName(Field::name);
+    if (field == nullptr) {
+      throw std::runtime_error("Unknown field name: " +
+                               std::string(Field::name));
+    }
+    bool matches;
+    if constexpr (std::is_arithmetic_v<V> || std::is_same_v<V, char *> ||
+                  std::is_same_v<V, std::string>) {
+      matches = !field->is_repeated() && same_type_<V>(*field);
+    } else {
+      matches = field->is_repeated() &&
+                same_type_<typename V::value_type>(*field);
+    }
+    if (!matches) {
+      throw std::runtime_error("PROTO_MEMBER " + std::string(Field::name) +
+                               " does not match the type of " +
+                               field->full_name());
+    }
+  }
+
+  template <size_t... I> static void check_members_(std::index_sequence<I...>) {
+    (check_member_<std::tuple_element_t<I, Members>>(), ...);
+  }
+
+  template <typename Field> static const char *sql_type_() {
+    using V = typename Field::type;
+    if constexpr (std::is_same_v<V, bool>) {
+      return "BOOLEAN";
+    } else if constexpr (std::is_integral_v<V>) {
+      return "INTEGER";
+    } else if constexpr (std::is_floating_point_v<V>) {
+      return "REAL";
+    } else if constexpr (std::is_same_v<V, char *> ||
+                         std::is_same_v<V, std::string>) {
+      return "TEXT";
+    } else {
+      return "BLOB";
+    }
+  }
+
+  template <typename Field>
+  static void bind_member_(sqlite3_stmt *stmt, int index, const C &obj) {
+    using V = typename Field::type;
+    const char *data = (const char *)&obj + Field::offset;
+    if constexpr (std::is_same_v<V, bool>) {
+      sqlite3_bind_int(stmt, index, *(const bool *)data);
+    } else if constexpr (std::is_unsigned_v<V> && sizeof(V) == 4) {
+      // uint32 fields are stored as int32, like ProtoDBConvertor does
+      sqlite3_bind_int(stmt, index, (int32_t) * (const V *)data);
+    } else if constexpr (std::is_integral_v<V>) {
+      sqlite3_bind_int64(stmt, index, (sqlite3_int64) * (const V *)data);
+    } else if constexpr (std::is_floating_point_v<V>) {
+      sqlite3_bind_double(stmt, index, *(const V *)data);
+    } else if constexpr (std::is_same_v<V, char *>) {
+      sqlite3_bind_text(stmt, index, data, (int)strnlen(data, Field::size),
+                        SQLITE_STATIC);
+    } else if constexpr (std::is_same_v<V, std::string>) {
+      const auto &value = *(const std::string *)data;
+      sqlite3_bind_text(stmt, index, value.data(), (int)value.size(),
+                        SQLITE_STATIC);
+    } else if constexpr (std::is_same_v<V, std::vector<std::string>>) {
+      std::string buffer;
+      for (const auto &value : *(const V *)data) {
+        encode_packed_length((uint32_t)value.size(), &buffer);
+        buffer.append(value);
+      }
+      sqlite3_bind_blob(stmt, index, buffer.data(), (int)buffer.size(),
+                        SQLITE_TRANSIENT);
+    } else {
+      using E = typename V::value_type;
+      static_assert(std::is_arithmetic_v<E> && !std::is_same_v<E, bool>,
+                    "Unsupported PROTO_MEMBER vector type");
+      const auto &values = *(const V *)data;
+      if (values.empty()) {
+        sqlite3_bind_zeroblob(stmt, index, 0);
+      } else if constexpr (host_little_endian()) {
+        sqlite3_bind_blob(stmt, index, values.data(),
+                          (int)(values.size() * sizeof(E)), SQLITE_STATIC);
+      } else {
+        std::string buffer;
+        encode_packed(values.data(), values.size(), &buffer);
+        sqlite3_bind_blob(stmt, index, buffer.data(), (int)buffer.size(),
+                          SQLITE_TRANSIENT);
+      }
+    }
+  }
+
+  template <typename Field>
+  static void extract_member_(sqlite3_stmt *stmt, int i, C &obj) {
+    using V = typename Field::type;
+    char *data = (char *)&obj + Field::offset;
+    if constexpr (std::is_same_v<V, bool>) {
+      *(bool *)data = sqlite3_column_int(stmt, i) != 0;
+    } else if constexpr (std::is_unsigned_v<V> && sizeof(V) == 4) {
+      *(V *)data = (V)(uint32_t)sqlite3_column_int(stmt, i);
+    } else if constexpr (std::is_integral_v<V>) {
+      *(V *)data = (V)sqlite3_column_int64(stmt, i);
+    } else if constexpr (std::is_floating_point_v<V>) {
+      *(V *)data = (V)sqlite3_column_double(stmt, i);
+    } else if constexpr (std::is_same_v<V, char *>) {
+      const void *text = sqlite3_column_text(stmt, i);
+      size_t size =
+          std::min((size_t)sqlite3_column_bytes(stmt, i), Field::size - 1);
+      if (size != 0) {
+        memcpy(data, text, size);
+      }
+      data[size] = '\0';
+    } else if constexpr (std::is_same_v<V, std::string>) {
+      const auto *text = (const char *)sqlite3_column_text(stmt, i);
+      ((std::string *)data)->assign(text ? text : "",
+                                    sqlite3_column_bytes(stmt, i));
+    } else if constexpr (std::is_same_v<V, std::vector<std::string>>) {
+      auto &values = *(V *)data;
+      values.clear();
+      decode_packed_strings(sqlite3_column_blob(stmt, i),
+                            sqlite3_column_bytes(stmt, i),
+                            [&values](const char *value, size_t size) {
+                              values.emplace_back(value, size);
+                            });
+    } else {
+      using E = typename V::value_type;
+      auto &values = *(V *)data;
+      size_t bytes = sqlite3_column_bytes(stmt, i);
+      if (bytes % sizeof(E) != 0) {
+        throw std::runtime_error("Corrupt packed column: " +
+                                 std::string(Field::name));
+      }
+      values.resize(bytes / sizeof(E));
+      if (bytes != 0) {
+        decode_packed(sqlite3_column_blob(stmt, i), bytes, values.data());
+      }
+    }
+  }
+
+  template <size_t... I>
+  static const std::array<Binder, member_count> &
+  binders_(std::index_sequence<I...>) {
+    static const std::array<Binder, member_count> binders = {
+        &bind_member_<std::tuple_element_t<I, Members>>...};
+    return binders;
+  }
+
+  static const std::array<Binder, member_count> &binders_() {
+    return binders_(std::make_index_sequence<member_count>());
+  }
+
+  template <size_t... I>
+  static void bind_all_(sqlite3_stmt *stmt, const C &obj,
+                        std::index_sequence<I...>) {
+    (bind_member_<std::tuple_element_t<I, Members>>(stmt, (int)I + 1, obj),
+     ...);
+  }
+
+  template <size_t... I>
+  static void extract_all_(sqlite3_stmt *stmt, C &obj,
+                           std::index_sequence<I...>) {
+    (extract_member_<std::tuple_element_t<I, Members>>(stmt, (int)I, obj),
+     ...);
+  }
+
+  template <size_t... I>
+  std::string column_definitions_(std::index_sequence<I...>) const {
+    std::string definitions;
+    ((definitions += std::string(std::tuple_element_t<I, Members>::name) +
+                     " " + sql_type_<std::tuple_element_t<I, Members>>() +
+                     (primary_key_ == std::tuple_element_t<I, Members>::name
+                          ? " PRIMARY KEY NOT NULL ON CONFLICT REPLACE,"
+                          : ",")),
+     ...);
+    definitions.pop_back();
+    return definitions;
+  }
+
+  bool create_table_() {
+    std::string create_sql =
+        "CREATE TABLE IF NOT EXISTS " + table_name_ + " (" +
+        column_definitions_(std::make_index_sequence<member_count>()) + ");";
+    char *errmsg;
+    if (sqlite3_exec(db_->get(), create_sql.c_str(), nullptr, nullptr,
+                     &errmsg) != SQLITE_OK) {
+      std::cerr << "Failed to create table: " << errmsg;
+      sqlite3_free(errmsg);
+      return false;
+    }
+    return true;
+  }
+
+  void write_(const C &obj) {
+    bind_all_(insert_stmt_, obj, std::make_index_sequence<member_count>());
+    step_(insert_stmt_);
+  }
+
+  void step_(sqlite3_stmt *stmt) {
+    int rc = sqlite3_step(stmt);
+    if (rc != SQLITE_DONE) {
+      std::string error = sqlite3_errmsg(db_->get());
+      sqlite3_reset(stmt);
+      throw std::runtime_error("Failed to write " + table_name_ + ": " +
+                               error);
+    }
+    sqlite3_reset(stmt);
+  }
+
+  sqlite3_stmt *insert_stmt_ = nullptr;
+  sqlite3_stmt *delete_stmt_ = nullptr;
+  std::string table_name_;
+  std::string column_list_;
+  std::string primary_key_;
+  int primary_index_ = -1;
+  std::shared_ptr<SafeSQLite> db_;
+  size_t batch_size_ = 1000;
+};
+
+} // namespace proto_mapper
+#endif // PROTODB_PROTO_STRUCT_DB_CONVERTOR_HPP
@@ -13,6 +13,17 @@ macro(add_protolib libname proto_dir proto_out cmdenv protoc)
     endif ()
 
 
+    # with the protoc-gen-protodb target defined, every proto also gets a
+    # <name>.protodb.h holding its ProtoDBCodec specializations
+    set(PROTODB_PLUGIN_ARGS)
+    set(PROTODB_PLUGIN_DEPENDS)
+    if (TARGET protoc-gen-protodb)
+        set(PROTODB_PLUGIN_ARGS
+                --plugin=protoc-gen-protodb=$<TARGET_FILE:protoc-gen-protodb>
+                --protodb_out ${proto_out})
+        set(PROTODB_PLUGIN_DEPENDS protoc-gen-protodb)
+    endif ()
+
     file(GLOB_RECURSE MSG_PROTOS ${proto_dir}/*.proto)
     set(PROTO_SRC)
     foreach(proto_file ${MSG_PROTOS})
@@ -22,13 +33,17 @@ macro(add_protolib libname proto_dir proto_out cmdenv protoc)
 
         string(REPLACE ".proto" ".pb.cc" FILE_NAME_CC ${FILE_PATH_REL})
         string(REPLACE ".proto" ".pb.h" FILE_NAME_H ${FILE_PATH_REL})
+        set(FILE_NAME_DB)
+        if (PROTODB_PLUGIN_DEPENDS)
+            string(REPLACE ".proto" ".protodb.h" FILE_NAME_DB ${FILE_PATH_REL})
+        endif ()
         message("pb file ${proto_file} ${FILE_NAME_CC}")
 
         add_custom_command(
-                OUTPUT ${FILE_NAME_CC} ${FILE_NAME_H}
+                OUTPUT ${FILE_NAME_CC} ${FILE_NAME_H} ${FILE_NAME_DB}
                 COMMAND ${CMAKE_COMMAND} -E env "${cmdenv}:$ENV{LD_LIBRARY_PATH}"
-                ${protoc} ARGS --cpp_out ${proto_out} -I ${proto_dir} ${proto_file}
-                DEPENDS ${proto_file}
+                ${protoc} ARGS --cpp_out ${proto_out} ${PROTODB_PLUGIN_ARGS} -I ${proto_dir} ${proto_file}
+                DEPENDS ${proto_file} ${PROTODB_PLUGIN_DEPENDS}
                 COMMENT "Running C++ protocol buffer compiler on ${proto_file}"
         )
         set(PROTO_SRC ${PROTO_SRC} ${FILE_NAME_CC})
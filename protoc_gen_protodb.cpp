@@ -0,0 +1,402 @@
+// =================================
+// Created by Lipson on 24-4-1.
+// Email to LipsonChan@yahoo.com
+// Copyright (c) 2024 Lipson. All rights reserved.
+// Version 1.0
+// =================================
+
+// protoc plugin writing <file>.protodb.h next to <file>.pb.h. For every
+// message it specializes proto_mapper::ProtoDBCodec with bind/decode
+// functions that call the generated accessors, which a ProtoDBConvertor
+// constructed with generated_codec uses instead of reflection. The table
+// SQL stays with the convertor.
+//
+// The plugin protocol (CodeGeneratorRequest/Response) is read and written
+// with the wire-format primitives of libprotobuf, so only libprotobuf is
+// needed to build it, not the libprotoc headers.
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using google::protobuf::Descriptor;
+using google::protobuf::EnumDescriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::FileDescriptor;
+
+namespace {
+
+struct Request {
+  std::vector<std::string> files_to_generate;
+  std::vector<google::protobuf::FileDescriptorProto> proto_files;
+};
+
+struct OutputFile {
+  std::string name;
+  std::string content;
+};
+
+bool skip_field(google::protobuf::io::CodedInputStream *input, uint32_t tag) {
+  switch (tag & 7) {
+  case 0: {
+    uint64_t ignored;
+    return input->ReadVarint64(&ignored);
+  }
+  case 1:
+    return input->Skip(8);
+  case 2: {
+    uint32_t size;
+    return input->ReadVarint32(&size) && input->Skip((int)size);
+  }
+  case 5:
+    return input->Skip(4);
+  default:
+    return false;
+  }
+}
+
+bool read_request(Request *request) {
+  google::protobuf::io::FileInputStream stream(STDIN_FILENO);
+  google::protobuf::io::CodedInputStream input(&stream);
+  input.SetTotalBytesLimit(INT32_MAX);
+  while (uint32_t tag = input.ReadTag()) {
+    std::string bytes;
+    uint32_t size;
+    switch (tag) {
+    case (1 << 3) | 2: // file_to_generate
+      if (!input.ReadVarint32(&size) || !input.ReadString(&bytes, (int)size)) {
+        return false;
+      }
+      request->files_to_generate.push_back(bytes);
+      break;
+    case (15 << 3) | 2: // proto_file
+      if (!input.ReadVarint32(&size) || !input.ReadString(&bytes, (int)size)) {
+        return false;
+      }
+      request->proto_files.emplace_back();
+      if (!request->proto_files.back().ParseFromString(bytes)) {
+        return false;
+      }
+      break;
+    default:
+      if (!skip_field(&input, tag)) {
+        return false;
+      }
+    }
+  }
+  return input.ConsumedEntireMessage();
+}
+
+void write_bytes_field(google::protobuf::io::CodedOutputStream *output,
+                       int number, const std::string &value) {
+  output->WriteTag((uint32_t)(number << 3) | 2);
+  output->WriteVarint32((uint32_t)value.size());
+  output->WriteString(value);
+}
+
+void write_response(const std::string &error,
+                    const std::vector<OutputFile> &files) {
+  google::protobuf::io::FileOutputStream stream(STDOUT_FILENO);
+  {
+    google::protobuf::io::CodedOutputStream output(&stream);
+    if (!error.empty()) {
+      write_bytes_field(&output, 1, error);
+    }
+    output.WriteTag((2 << 3) | 0); // supported_features
+    output.WriteVarint64(1);       // FEATURE_PROTO3_OPTIONAL
+    for (const auto &file : files) {
+      std::string encoded;
+      {
+        google::protobuf::io::StringOutputStream buffer(&encoded);
+        google::protobuf::io::CodedOutputStream nested(&buffer);
+        write_bytes_field(&nested, 1, file.name);
+        write_bytes_field(&nested, 15, file.content);
+      }
+      write_bytes_field(&output, 15, encoded);
+    }
+  }
+  stream.Close();
+}
+
+const std::set<std::string> &cpp_keywords() {
+  static const std::set<std::string> keywords = {
+      "alignas",   "alignof",   "and",          "and_eq",    "asm",
+      "auto",      "bitand",    "bitor",        "bool",      "break",
+      "case",      "catch",     "char",         "class",     "compl",
+      "const",     "constexpr", "const_cast",   "continue",  "decltype",
+      "default",   "delete",    "do",           "double",    "dynamic_cast",
+      "else",      "enum",      "explicit",     "export",    "extern",
+      "false",     "float",     "for",          "friend",    "goto",
+      "if",        "inline",    "int",          "long",      "mutable",
+      "namespace", "new",       "noexcept",     "not",       "not_eq",
+      "NULL",      "nullptr",   "operator",     "or",        "or_eq",
+      "private",   "protected", "public",       "register",  "reinterpret_cast",
+      "return",    "short",     "signed",       "sizeof",    "static",
+      "static_assert", "static_cast", "struct", "switch",    "template",
+      "this",      "thread_local", "throw",     "true",      "try",
+      "typedef",   "typeid",    "typename",     "union",     "unsigned",
+      "using",     "virtual",   "void",         "volatile",  "wchar_t",
+      "while",     "xor",       "xor_eq"};
+  return keywords;
+}
+
+// The accessor name protoc's C++ generator gives field.
+std::string accessor(const FieldDescriptor *field) {
+  std::string name = field->name();
+  for (auto &c : name) {
+    c = (char)std::tolower((unsigned char)c);
+  }
+  if (cpp_keywords().count(name) != 0) {
+    name += "_";
+  }
+  return name;
+}
+
+std::string qualified_name(const std::string &package,
+                           const std::string &full_name) {
+  std::string relative =
+      package.empty() ? full_name : full_name.substr(package.size() + 1);
+  std::string result = "::";
+  for (char c : package) {
+    result += c == '.' ? std::string("::") : std::string(1, c);
+  }
+  if (!package.empty()) {
+    result += "::";
+  }
+  for (char c : relative) {
+    result += c == '.' ? '_' : c;
+  }
+  return result;
+}
+
+std::string class_name(const Descriptor *message) {
+  return qualified_name(message->file()->package(), message->full_name());
+}
+
+std::string enum_name(const EnumDescriptor *type) {
+  return qualified_name(type->file()->package(), type->full_name());
+}
+
+// Fields the convertor stores as plain columns and the codec can handle.
+bool is_codec_field(const FieldDescriptor *field) {
+  if (field->is_repeated() ||
+      field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+    return false;
+  }
+  return field->cpp_type() != FieldDescriptor::CPPTYPE_STRING ||
+         field->options().ctype() == google::protobuf::FieldOptions::STRING;
+}
+
+// The sqlite3_bind_* call for field at parameter index, reading obj.
+std::string bind_statement(const FieldDescriptor *field,
+                           const std::string &index) {
+  std::string value = "obj." + accessor(field) + "()";
+  switch (field->type()) {
+  case FieldDescriptor::TYPE_INT64:
+  case FieldDescriptor::TYPE_SINT64:
+  case FieldDescriptor::TYPE_SFIXED64:
+  case FieldDescriptor::TYPE_UINT64:
+  case FieldDescriptor::TYPE_FIXED64:
+    return "sqlite3_bind_int64(stmt, " + index + ", (sqlite3_int64)" + value +
+           ");";
+  case FieldDescriptor::TYPE_FLOAT:
+  case FieldDescriptor::TYPE_DOUBLE:
+    return "sqlite3_bind_double(stmt, " + index + ", " + value + ");";
+  case FieldDescriptor::TYPE_ENUM:
+    return "sqlite3_bind_int(stmt, " + index + ", (int)" + value + ");";
+  case FieldDescriptor::TYPE_STRING:
+    return "sqlite3_bind_text(stmt, " + index + ", " + value + ".data(), (int)" +
+           value + ".size(), SQLITE_STATIC);";
+  case FieldDescriptor::TYPE_BYTES:
+    return "sqlite3_bind_blob(stmt, " + index + ", " + value + ".data(), (int)" +
+           value + ".size(), SQLITE_STATIC);";
+  default: // 32-bit integers and bool, as the reflection binders do
+    return "sqlite3_bind_int(stmt, " + index + ", " + value + ");";
+  }
+}
+
+// Statements setting field on obj from result column i, which is not NULL.
+std::string decode_statement(const FieldDescriptor *field,
+                             const std::string &i) {
+  std::string name = accessor(field);
+  switch (field->type()) {
+  case FieldDescriptor::TYPE_INT64:
+  case FieldDescriptor::TYPE_SINT64:
+  case FieldDescriptor::TYPE_SFIXED64:
+  case FieldDescriptor::TYPE_UINT64:
+  case FieldDescriptor::TYPE_FIXED64:
+    return "obj->set_" + name + "(sqlite3_column_int64(stmt, " + i + "));";
+  case FieldDescriptor::TYPE_FLOAT:
+    return "obj->set_" + name + "((float)sqlite3_column_double(stmt, " + i +
+           "));";
+  case FieldDescriptor::TYPE_DOUBLE:
+    return "obj->set_" + name + "(sqlite3_column_double(stmt, " + i + "));";
+  case FieldDescriptor::TYPE_BOOL:
+    return "obj->set_" + name + "(sqlite3_column_int(stmt, " + i + ") != 0);";
+  case FieldDescriptor::TYPE_ENUM: {
+    std::string type = enum_name(field->enum_type());
+    // proto2 enums are closed, unknown numbers must not be set
+    if (field->enum_type()->file()->syntax() ==
+        FileDescriptor::SYNTAX_PROTO2) {
+      return "int value = sqlite3_column_int(stmt, " + i + ");\n      if (" +
+             type + "_IsValid(value)) {\n        obj->set_" + name +
+             "(static_cast<" + type + ">(value));\n      }";
+    }
+    return "obj->set_" + name + "(static_cast<" + type +
+           ">(sqlite3_column_int(stmt, " + i + ")));";
+  }
+  case FieldDescriptor::TYPE_STRING:
+    return "obj->mutable_" + name +
+           "()->assign(reinterpret_cast<const char *>(sqlite3_column_text("
+           "stmt, " +
+           i + ")), sqlite3_column_bytes(stmt, " + i + "));";
+  case FieldDescriptor::TYPE_BYTES:
+    return "const void *data = sqlite3_column_blob(stmt, " + i +
+           ");\n      obj->mutable_" + name +
+           "()->assign(data == nullptr ? \"\" : static_cast<const char "
+           "*>(data), sqlite3_column_bytes(stmt, " +
+           i + "));";
+  default:
+    return "obj->set_" + name + "(sqlite3_column_int(stmt, " + i + "));";
+  }
+}
+
+void generate_message(const Descriptor *message, std::ostringstream &out) {
+  for (int i = 0; i < message->nested_type_count(); ++i) {
+    if (!message->nested_type(i)->options().map_entry()) {
+      generate_message(message->nested_type(i), out);
+    }
+  }
+
+  std::vector<const FieldDescriptor *> fields;
+  for (int i = 0; i < message->field_count(); ++i) {
+    if (is_codec_field(message->field(i))) {
+      fields.push_back(message->field(i));
+    }
+  }
+  std::string type = class_name(message);
+
+  out << "template <> struct ProtoDBCodec<" << type << "> {\n"
+      << "  static constexpr size_t column_count = " << fields.size()
+      << ";\n\n";
+
+  for (const auto *field : fields) {
+    std::string name = accessor(field);
+    out << "  static void bind_" << name
+        << "(sqlite3_stmt *stmt, int index,\n"
+        << "      const google::protobuf::Message &message,\n"
+        << "      const google::protobuf::FieldDescriptor *) {\n"
+        << "    const auto &obj = static_cast<const " << type
+        << " &>(message);\n"
+        << "    " << bind_statement(field, "index") << "\n"
+        << "  }\n\n"
+        << "  static void extract_" << name
+        << "(sqlite3_stmt *stmt, int i,\n"
+        << "      google::protobuf::Message *message,\n"
+        << "      const google::protobuf::FieldDescriptor *) {\n"
+        << "    if (sqlite3_column_type(stmt, i) != SQLITE_NULL) {\n"
+        << "      auto *obj = static_cast<" << type << " *>(message);\n"
+        << "      " << decode_statement(field, "i") << "\n"
+        << "    }\n"
+        << "  }\n\n";
+  }
+
+  out << "  static const ProtoDBCodecColumn *columns() {\n"
+      << "    static const ProtoDBCodecColumn columns[] = {\n";
+  for (const auto *field : fields) {
+    out << "        {\"" << field->name() << "\", &bind_" << accessor(field)
+        << ", &extract_" << accessor(field) << "},\n";
+  }
+  out << "        {nullptr, nullptr, nullptr}};\n"
+      << "    return columns;\n"
+      << "  }\n\n";
+
+  out << "  // binds every column, in columns() order from index 1\n"
+      << "  static void bind(sqlite3_stmt *stmt, const " << type
+      << " &obj) {\n";
+  for (size_t i = 0; i < fields.size(); ++i) {
+    out << "    " << bind_statement(fields[i], std::to_string(i + 1)) << "\n";
+  }
+  out << "  }\n\n"
+      << "  // decodes a row selecting every column in columns() order\n"
+      << "  static void decode(sqlite3_stmt *stmt, " << type << " *obj) {\n";
+  for (size_t i = 0; i < fields.size(); ++i) {
+    std::string index = std::to_string(i);
+    out << "    if (sqlite3_column_type(stmt, " << index
+        << ") != SQLITE_NULL) {\n"
+        << "      " << decode_statement(fields[i], index) << "\n"
+        << "    }\n";
+  }
+  out << "  }\n"
+      << "};\n\n";
+}
+
+std::string strip_proto(const std::string &name) {
+  if (name.size() > 6 && name.compare(name.size() - 6, 6, ".proto") == 0) {
+    return name.substr(0, name.size() - 6);
+  }
+  return name;
+}
+
+OutputFile generate_file(const FileDescriptor *file) {
+  std::string base = strip_proto(file->name());
+  std::string guard = "PROTODB_GENERATED_";
+  for (char c : base) {
+    guard += std::isalnum((unsigned char)c) ? (char)std::toupper(c) : '_';
+  }
+  guard += "_PROTODB_H";
+
+  std::ostringstream out;
+  out << "// Generated by protoc-gen-protodb from " << file->name()
+      << ". DO NOT EDIT.\n\n"
+      << "#ifndef " << guard << "\n"
+      << "#define " << guard << "\n\n"
+      << "#include \"" << base << ".pb.h\"\n"
+      << "#include \"proto_db_convertor.hpp\"\n\n"
+      << "namespace proto_mapper {\n\n";
+  for (int i = 0; i < file->message_type_count(); ++i) {
+    generate_message(file->message_type(i), out);
+  }
+  out << "} // namespace proto_mapper\n"
+      << "#endif // " << guard << "\n";
+
+  return {base + ".protodb.h", out.str()};
+}
+
+} // namespace
+
+int main() {
+  Request request;
+  if (!read_request(&request)) {
+    std::cerr << "protoc-gen-protodb: failed to read the request"
+              << std::endl;
+    return 1;
+  }
+
+  google::protobuf::DescriptorPool pool;
+  for (const auto &proto : request.proto_files) {
+    if (pool.BuildFile(proto) == nullptr) {
+      write_response("Failed to load " + proto.name(), {});
+      return 0;
+    }
+  }
+
+  std::vector<OutputFile> files;
+  for (const auto &name : request.files_to_generate) {
+    const FileDescriptor *file = pool.FindFileByName(name);
+    if (file == nullptr) {
+      write_response("Unknown file " + name, {});
+      return 0;
+    }
+    files.push_back(generate_file(file));
+  }
+  write_response("", files);
+  return 0;
+}